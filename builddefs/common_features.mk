@@ -131,6 +131,7 @@ ifeq ($(strip $(POINTING_DEVICE_ENABLE)), yes)
         VPATH += $(QUANTUM_DIR)/pointing_device
         SRC += $(QUANTUM_DIR)/pointing_device/pointing_device.c
         SRC += $(QUANTUM_DIR)/pointing_device/pointing_device_auto_mouse.c
+        SRC += $(QUANTUM_DIR)/pointing_device/pointing_device_accel.c
         ifneq ($(strip $(POINTING_DEVICE_DRIVER)), custom)
             SRC += drivers/sensors/$(strip $(POINTING_DEVICE_DRIVER)).c
             OPT_DEFS += -DPOINTING_DEVICE_DRIVER_$(strip $(shell echo $(POINTING_DEVICE_DRIVER) | tr '[:lower:]' '[:upper:]'))
@@ -635,7 +636,7 @@ ifeq ($(strip $(VIA_ENABLE)), yes)
     TRI_LAYER_ENABLE := yes
 endif
 
-VALID_CUSTOM_MATRIX_TYPES:= yes lite no
+VALID_CUSTOM_MATRIX_TYPES:= yes lite vendor no
 
 CUSTOM_MATRIX ?= no
 ifneq ($(strip $(CUSTOM_MATRIX)), yes)
@@ -647,7 +648,14 @@ ifneq ($(strip $(CUSTOM_MATRIX)), yes)
     QUANTUM_SRC += $(QUANTUM_DIR)/matrix_common.c
 
     # if 'lite' then skip the actual matrix implementation
-    ifneq ($(strip $(CUSTOM_MATRIX)), lite)
+    ifeq ($(strip $(CUSTOM_MATRIX)), vendor)
+        # Vendor-specific implementations scan the matrix in hardware, on top of 'lite'
+        ifeq ($(strip $(MCU_SERIES)), RP2040)
+            SRC += matrix_vendor.c
+        else
+            $(call CATASTROPHIC_ERROR,Invalid CUSTOM_MATRIX,There is no vendor-provided matrix driver available)
+        endif
+    else ifneq ($(strip $(CUSTOM_MATRIX)), lite)
         # Include the standard or split matrix code if needed
         QUANTUM_SRC += $(QUANTUM_DIR)/matrix.c
     endif
@@ -18,6 +18,24 @@
 #include <string.h>
 
 #include "eeprom_driver.h"
+#if defined(EEPROM_I2C)
+#    include "eeprom_i2c.h"
+#elif defined(EEPROM_SPI)
+#    include "eeprom_spi.h"
+#endif
+
+/*
+    Block updates are compared and written this many bytes at a time, aligned
+    to the same boundary. For external EEPROMs this matches the page size, so
+    that every write issued stays within a single page.
+*/
+#ifndef EEPROM_UPDATE_CHUNK_SIZE
+#    ifdef EXTERNAL_EEPROM_PAGE_SIZE
+#        define EEPROM_UPDATE_CHUNK_SIZE EXTERNAL_EEPROM_PAGE_SIZE
+#    else
+#        define EEPROM_UPDATE_CHUNK_SIZE 32
+#    endif
+#endif
 
 uint8_t eeprom_read_byte(const uint8_t *addr) {
     uint8_t ret = 0;
@@ -50,10 +68,33 @@ void eeprom_write_dword(uint32_t *addr, uint32_t value) {
 }
 
 void eeprom_update_block(const void *buf, void *addr, size_t len) {
-    uint8_t read_buf[len];
-    eeprom_read_block(read_buf, addr, len);
-    if (memcmp(buf, read_buf, len) != 0) {
-        eeprom_write_block(buf, addr, len);
+    const uint8_t *source = (const uint8_t *)buf;
+    uintptr_t      target = (uintptr_t)addr;
+    uint8_t        read_buf[EEPROM_UPDATE_CHUNK_SIZE];
+
+    while (len > 0) {
+        size_t chunk = EEPROM_UPDATE_CHUNK_SIZE - (target % EEPROM_UPDATE_CHUNK_SIZE);
+        if (chunk > len) {
+            chunk = len;
+        }
+        eeprom_read_block(read_buf, (const void *)target, chunk);
+
+        // Only rewrite the span of this chunk that actually changed
+        size_t first = 0;
+        size_t last  = chunk;
+        while (first < last && read_buf[first] == source[first]) {
+            ++first;
+        }
+        while (last > first && read_buf[last - 1] == source[last - 1]) {
+            --last;
+        }
+        if (first < last) {
+            eeprom_write_block(source + first, (void *)(target + first), last - first);
+        }
+
+        source += chunk;
+        target += chunk;
+        len -= chunk;
     }
 }
 
@@ -46,6 +46,14 @@
 #    include "debug.h"
 #endif // DEBUG_EEPROM_OUTPUT
 
+#ifdef EXTERNAL_EEPROM_I2C_ACK_POLLING
+#    include "timer.h"
+
+static bool     write_in_progress = false;
+static uint8_t  write_device;
+static uint16_t write_start;
+#endif // EXTERNAL_EEPROM_I2C_ACK_POLLING
+
 static inline void fill_target_address(uint8_t *buffer, const void *addr) {
     uintptr_t p = (uintptr_t)addr;
     for (int i = 0; i < EXTERNAL_EEPROM_ADDRESS_SIZE; ++i) {
@@ -54,6 +62,39 @@ static inline void fill_target_address(uint8_t *buffer, const void *addr) {
     }
 }
 
+/*
+    Waits for the internal write cycle of the previous page write to complete.
+
+    With ACK polling, the EEPROM does not acknowledge its address until the
+    write cycle has finished, so this returns as soon as it responds again,
+    falling back to EXTERNAL_EEPROM_WRITE_TIME. The wait is deferred until the
+    next access, so that the firmware can carry on in the meantime.
+*/
+static void eeprom_i2c_wait_for_write(void) {
+#ifdef EXTERNAL_EEPROM_I2C_ACK_POLLING
+    if (!write_in_progress) {
+        return;
+    }
+    write_in_progress = false;
+
+    while (timer_elapsed(write_start) <= EXTERNAL_EEPROM_WRITE_TIME) {
+        if (i2c_ping_address(write_device, 1) == I2C_STATUS_SUCCESS) {
+            break;
+        }
+    }
+#endif // EXTERNAL_EEPROM_I2C_ACK_POLLING
+}
+
+static void eeprom_i2c_start_write(uint8_t device) {
+#ifdef EXTERNAL_EEPROM_I2C_ACK_POLLING
+    write_in_progress = true;
+    write_device      = device;
+    write_start       = timer_read();
+#else
+    wait_ms(EXTERNAL_EEPROM_WRITE_TIME);
+#endif // EXTERNAL_EEPROM_I2C_ACK_POLLING
+}
+
 void eeprom_driver_init(void) {
     i2c_init();
 #if defined(EXTERNAL_EEPROM_WP_PIN)
@@ -90,6 +131,8 @@ void eeprom_read_block(void *buf, const void *addr, size_t len) {
     uint8_t complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE];
     fill_target_address(complete_packet, addr);
 
+    eeprom_i2c_wait_for_write();
+
     i2c_transmit(EXTERNAL_EEPROM_I2C_ADDRESS((uintptr_t)addr), complete_packet, EXTERNAL_EEPROM_ADDRESS_SIZE, 100);
     i2c_receive(EXTERNAL_EEPROM_I2C_ADDRESS((uintptr_t)addr), buf, len, 100);
 
@@ -132,8 +175,9 @@ void eeprom_write_block(const void *buf, void *addr, size_t len) {
         dprintf("\n");
 #endif // DEBUG_EEPROM_OUTPUT
 
+        eeprom_i2c_wait_for_write();
         i2c_transmit(EXTERNAL_EEPROM_I2C_ADDRESS((uintptr_t)addr), complete_packet, EXTERNAL_EEPROM_ADDRESS_SIZE + write_length, 100);
-        wait_ms(EXTERNAL_EEPROM_WRITE_TIME);
+        eeprom_i2c_start_write(EXTERNAL_EEPROM_I2C_ADDRESS((uintptr_t)addr));
 
         read_buf += write_length;
         target_addr += write_length;
@@ -141,6 +185,8 @@ void eeprom_write_block(const void *buf, void *addr, size_t len) {
     }
 
 #if defined(EXTERNAL_EEPROM_WP_PIN)
+    /* Keep write protection disabled until the last write cycle has completed */
+    eeprom_i2c_wait_for_write();
     /* We are setting the WP pin to high in a way that requires at least two bit-flips to change back to 0 */
     gpio_write_pin(EXTERNAL_EEPROM_WP_PIN, 1);
     gpio_set_pin_input_high(EXTERNAL_EEPROM_WP_PIN);
@@ -31,6 +31,7 @@ extern volatile bool isLeftHand;
 
 __attribute__((weak)) void    encoder_quadrature_init_pin(uint8_t index, bool pad_b);
 __attribute__((weak)) uint8_t encoder_quadrature_read_pin(uint8_t index, bool pad_b);
+void                          encoder_quadrature_handle_read(uint8_t index, uint8_t pin_a_state, uint8_t pin_b_state);
 
 #ifdef ENCODER_DEFAULT_PIN_API_IMPL
 
@@ -83,6 +84,46 @@ static uint8_t thisHand, thatHand;
 static uint8_t thatCount;
 #endif
 
+#ifdef ENCODER_INTERRUPT_ENABLE
+void encoder_quadrature_isr(void) {
+    for (uint8_t i = 0; i < thisCount; i++) {
+        encoder_quadrature_handle_read(i, encoder_quadrature_read_pin(i, false), encoder_quadrature_read_pin(i, true));
+    }
+}
+
+#    if defined(PROTOCOL_CHIBIOS) && defined(ENCODER_DEFAULT_PIN_API_IMPL)
+#        if !PAL_USE_CALLBACKS
+#            error "ENCODER_INTERRUPT_ENABLE requires PAL_USE_CALLBACKS to be set to TRUE in halconf.h"
+#        endif
+
+static void encoder_quadrature_pal_callback(void *arg) {
+    (void)arg;
+    // The lock keeps encoder interrupts from nesting, so the event queue only ever has a single producer.
+    // Every encoder is sampled, so that pins shared between encoders are handled regardless of which line fired.
+    osalSysLockFromISR();
+    encoder_quadrature_isr();
+    osalSysUnlockFromISR();
+}
+
+static void encoder_quadrature_enable_line(pin_t pin) {
+    if (pin != NO_PIN) {
+        palEnableLineEvent(pin, PAL_EVENT_MODE_BOTH_EDGES);
+        palSetLineCallback(pin, encoder_quadrature_pal_callback, NULL);
+    }
+}
+#    endif // defined(PROTOCOL_CHIBIOS) && defined(ENCODER_DEFAULT_PIN_API_IMPL)
+
+__attribute__((weak)) void encoder_quadrature_interrupt_init(void) {
+#    if defined(PROTOCOL_CHIBIOS) && defined(ENCODER_DEFAULT_PIN_API_IMPL)
+    for (uint8_t i = 0; i < thisCount; i++) {
+        encoder_quadrature_enable_line(encoders_pad_a[i]);
+        encoder_quadrature_enable_line(encoders_pad_b[i]);
+    }
+#    endif
+    // Other platforms need to set up pin-change interrupts in keyboard code, calling `encoder_quadrature_isr()` from the handler.
+}
+#endif // ENCODER_INTERRUPT_ENABLE
+
 __attribute__((weak)) void encoder_quadrature_post_init_kb(void) {
     extern void encoder_quadrature_handle_read(uint8_t index, uint8_t pin_a_state, uint8_t pin_b_state);
     // Unused normally, but can be used for things like setting up pin-change interrupts in keyboard code.
@@ -103,6 +144,10 @@ void encoder_quadrature_post_init(void) {
     memset(encoder_state, 0, sizeof(encoder_state));
 #endif
 
+#ifdef ENCODER_INTERRUPT_ENABLE
+    encoder_quadrature_interrupt_init();
+#endif
+
     encoder_quadrature_post_init_kb();
 }
 
@@ -207,7 +252,10 @@ void encoder_quadrature_handle_read(uint8_t index, uint8_t pin_a_state, uint8_t
 }
 
 __attribute__((weak)) void encoder_driver_task(void) {
+#ifndef ENCODER_INTERRUPT_ENABLE
     for (uint8_t i = 0; i < thisCount; i++) {
         encoder_quadrature_handle_read(i, encoder_quadrature_read_pin(i, false), encoder_quadrature_read_pin(i, true));
     }
+#endif // ENCODER_INTERRUPT_ENABLE
+    // In interrupt mode, transitions are decoded and queued as they happen, so there is nothing to poll here.
 }
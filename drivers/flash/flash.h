@@ -95,6 +95,41 @@ flash_status_t flash_erase_block(uint32_t addr);
  */
 flash_status_t flash_erase_sector(uint32_t addr);
 
+/**
+ * @brief Initiates a block erase operation.
+ *
+ * This function does not wait for the flash to become ready. Completion can be polled with flash_is_busy().
+ *
+ * @param addr The address of the block to erase.
+ *
+ * @return FLASH_STATUS_SUCCESS if the erase command was successfully sent, FLASH_STATUS_BAD_ADDRESS if the address is out of bounds, FLASH_STATUS_TIMEOUT if the flash is busy, or FLASH_STATUS_ERROR if an error occurred.
+ */
+flash_status_t flash_begin_erase_block(uint32_t addr);
+
+/**
+ * @brief Initiates a sector erase operation.
+ *
+ * This function does not wait for the flash to become ready. Completion can be polled with flash_is_busy().
+ *
+ * @param addr The address of the sector to erase.
+ *
+ * @return FLASH_STATUS_SUCCESS if the erase command was successfully sent, FLASH_STATUS_BAD_ADDRESS if the address is out of bounds, FLASH_STATUS_TIMEOUT if the flash is busy, or FLASH_STATUS_ERROR if an error occurred.
+ */
+flash_status_t flash_begin_erase_sector(uint32_t addr);
+
+/**
+ * @brief Initiates programming of a single page of flash memory.
+ *
+ * This function does not wait for the flash to become ready. Completion can be polled with flash_is_busy().
+ *
+ * @param addr The address to start writing at.
+ * @param buf A pointer to the data to write.
+ * @param len The length of the data to write, which must not extend past the end of the page containing addr.
+ *
+ * @return FLASH_STATUS_SUCCESS if the program command was successfully sent, FLASH_STATUS_BAD_ADDRESS if the range is out of bounds or crosses a page boundary, FLASH_STATUS_TIMEOUT if the flash is busy, or FLASH_STATUS_ERROR if an error occurred.
+ */
+flash_status_t flash_begin_write_page(uint32_t addr, const void *buf, size_t len);
+
 /**
  * @brief Reads a range of flash memory.
  *
@@ -121,6 +156,18 @@ flash_status_t flash_read_range(uint32_t addr, void *buf, size_t len);
  */
 flash_status_t flash_write_range(uint32_t addr, const void *buf, size_t len);
 
+/**
+ * @brief Notifies cached users of flash contents that a range of flash memory is being erased or programmed.
+ *
+ * Flash drivers call this before starting an erase or program, so that anything caching flash contents (such as
+ * Quantum Painter's flash streams) can discard its copy of the affected range. Custom flash drivers should do the same.
+ * The default implementation does nothing.
+ *
+ * @param addr The address of the affected range.
+ * @param len The length of the affected range.
+ */
+void flash_contents_changed(uint32_t addr, size_t len);
+
 #ifdef __cplusplus
 }
 #endif
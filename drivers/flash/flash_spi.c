@@ -51,6 +51,14 @@
 #define FLASH_FLAG_WIP 0x01 /* Write in progress bit */
 #define FLASH_FLAG_WEL 0x02 /* Write enable latch bit */
 
+#ifdef EXTERNAL_FLASH_SPI_FAST_READ
+#    define FLASH_SPI_READ_CMD FLASH_CMD_FASTREAD
+#    define FLASH_SPI_READ_DUMMY_BYTES (EXTERNAL_FLASH_SPI_FAST_READ_DUMMY_BYTES)
+#else
+#    define FLASH_SPI_READ_CMD FLASH_CMD_READ
+#    define FLASH_SPI_READ_DUMMY_BYTES 0
+#endif
+
 // #define DEBUG_FLASH_SPI_OUTPUT
 
 static bool spi_flash_start(void) {
@@ -123,13 +131,18 @@ static flash_status_t spi_flash_write_disable(void) {
 /* This function is used for read transfer, write transfer and erase transfer. */
 static flash_status_t spi_flash_transaction(uint8_t cmd, uint32_t addr, uint8_t *data, size_t len) {
     flash_status_t response = FLASH_STATUS_SUCCESS;
-    uint8_t        buffer[EXTERNAL_FLASH_ADDRESS_SIZE + 1];
+    uint8_t        buffer[EXTERNAL_FLASH_ADDRESS_SIZE + 1 + FLASH_SPI_READ_DUMMY_BYTES];
+    size_t         header_length = EXTERNAL_FLASH_ADDRESS_SIZE + 1;
 
     buffer[0] = cmd;
     for (int i = 0; i < EXTERNAL_FLASH_ADDRESS_SIZE; ++i) {
         buffer[EXTERNAL_FLASH_ADDRESS_SIZE - i] = addr & 0xFF;
         addr >>= 8;
     }
+    if (cmd == FLASH_CMD_FASTREAD) {
+        memset(&buffer[header_length], 0, FLASH_SPI_READ_DUMMY_BYTES);
+        header_length += FLASH_SPI_READ_DUMMY_BYTES;
+    }
 
     bool res = spi_flash_start();
     if (!res) {
@@ -137,12 +150,19 @@ static flash_status_t spi_flash_transaction(uint8_t cmd, uint32_t addr, uint8_t
         return FLASH_STATUS_ERROR;
     }
 
-    response = spi_transmit(buffer, sizeof(buffer));
+    response = spi_transmit(buffer, header_length);
 
     if ((!response) && (data != NULL)) {
         switch (cmd) {
             case FLASH_CMD_READ:
-                response = spi_receive(data, len);
+            case FLASH_CMD_FASTREAD:
+                // Flash reads continue for as long as the clock runs, so large reads are received in bulk parts
+                while (!response && len > 0) {
+                    size_t part_length = MIN(len, (size_t)(EXTERNAL_FLASH_SPI_MAX_TRANSFER_SIZE));
+                    response           = spi_receive(data, part_length);
+                    data += part_length;
+                    len -= part_length;
+                }
                 break;
             case FLASH_CMD_PP:
                 response = spi_transmit(data, len);
@@ -158,10 +178,40 @@ static flash_status_t spi_flash_transaction(uint8_t cmd, uint32_t addr, uint8_t
     return response;
 }
 
+/* Starts an erase of the sector or block at the given address, without waiting for it to complete. */
+static flash_status_t spi_flash_begin_erase(uint8_t cmd, uint32_t addr) {
+    flash_status_t response = FLASH_STATUS_SUCCESS;
+
+    /* Wait for the write-in-progress bit to be cleared. */
+    response = spi_flash_wait_while_busy();
+    if (response != FLASH_STATUS_SUCCESS) {
+        dprint("Failed to check WIP flag! [spi flash erase]\n");
+        return response;
+    }
+
+    /* Enable writes. */
+    response = spi_flash_write_enable();
+    if (response != FLASH_STATUS_SUCCESS) {
+        dprint("Failed to write-enable! [spi flash erase]\n");
+        return response;
+    }
+
+    /* Erase. */
+    response = spi_flash_transaction(cmd, addr, NULL, 0);
+    if (response != FLASH_STATUS_SUCCESS) {
+        dprint("Failed to erase! [spi flash erase]\n");
+        return response;
+    }
+
+    return response;
+}
+
 void flash_init(void) {
     spi_init();
 }
 
+__attribute__((weak)) void flash_contents_changed(uint32_t addr, size_t len) {}
+
 flash_status_t flash_begin_erase_chip(void) {
     flash_status_t response = FLASH_STATUS_SUCCESS;
 
@@ -180,6 +230,7 @@ flash_status_t flash_begin_erase_chip(void) {
     }
 
     /* Erase Chip. */
+    flash_contents_changed(0, EXTERNAL_FLASH_SIZE);
     bool res = spi_flash_start();
     if (!res) {
         dprint("Failed to start SPI! [spi flash erase chip]\n");
@@ -209,33 +260,21 @@ flash_status_t flash_erase_chip(void) {
     return flash_wait_erase_chip();
 }
 
-flash_status_t flash_erase_sector(uint32_t addr) {
-    flash_status_t response = FLASH_STATUS_SUCCESS;
-
+flash_status_t flash_begin_erase_sector(uint32_t addr) {
     /* Check that the address exceeds the limit. */
-    if ((addr + (EXTERNAL_FLASH_SECTOR_SIZE)) >= (EXTERNAL_FLASH_SIZE) || ((addr % (EXTERNAL_FLASH_SECTOR_SIZE)) != 0)) {
+    if ((addr + (EXTERNAL_FLASH_SECTOR_SIZE)) > (EXTERNAL_FLASH_SIZE) || ((addr % (EXTERNAL_FLASH_SECTOR_SIZE)) != 0)) {
         dprintf("Flash erase sector address over limit! [addr:0x%lx]\n", (uint32_t)addr);
-        return FLASH_STATUS_ERROR;
+        return FLASH_STATUS_BAD_ADDRESS;
     }
 
-    /* Wait for the write-in-progress bit to be cleared. */
-    response = spi_flash_wait_while_busy();
-    if (response != FLASH_STATUS_SUCCESS) {
-        dprint("Failed to check WIP flag! [spi flash erase sector]\n");
-        return response;
-    }
-
-    /* Enable writes. */
-    response = spi_flash_write_enable();
-    if (response != FLASH_STATUS_SUCCESS) {
-        dprint("Failed to write-enable! [spi flash erase sector]\n");
-        return response;
-    }
+    flash_contents_changed(addr, EXTERNAL_FLASH_SECTOR_SIZE);
+    return spi_flash_begin_erase(FLASH_CMD_SE, addr);
+}
 
-    /* Erase Sector. */
-    response = spi_flash_transaction(FLASH_CMD_SE, addr, NULL, 0);
+flash_status_t flash_erase_sector(uint32_t addr) {
+    flash_status_t response = flash_begin_erase_sector(addr);
     if (response != FLASH_STATUS_SUCCESS) {
-        dprint("Failed to erase sector! [spi flash erase sector]\n");
+        dprint("Failed to begin erase sector! [spi flash erase sector]\n");
         return response;
     }
 
@@ -249,33 +288,21 @@ flash_status_t flash_erase_sector(uint32_t addr) {
     return response;
 }
 
-flash_status_t flash_erase_block(uint32_t addr) {
-    flash_status_t response = FLASH_STATUS_SUCCESS;
-
+flash_status_t flash_begin_erase_block(uint32_t addr) {
     /* Check that the address exceeds the limit. */
-    if ((addr + (EXTERNAL_FLASH_BLOCK_SIZE)) >= (EXTERNAL_FLASH_SIZE) || ((addr % (EXTERNAL_FLASH_BLOCK_SIZE)) != 0)) {
+    if ((addr + (EXTERNAL_FLASH_BLOCK_SIZE)) > (EXTERNAL_FLASH_SIZE) || ((addr % (EXTERNAL_FLASH_BLOCK_SIZE)) != 0)) {
         dprintf("Flash erase block address over limit! [addr:0x%lx]\n", (uint32_t)addr);
-        return FLASH_STATUS_ERROR;
+        return FLASH_STATUS_BAD_ADDRESS;
     }
 
-    /* Wait for the write-in-progress bit to be cleared. */
-    response = spi_flash_wait_while_busy();
-    if (response != FLASH_STATUS_SUCCESS) {
-        dprint("Failed to check WIP flag! [spi flash erase block]\n");
-        return response;
-    }
-
-    /* Enable writes. */
-    response = spi_flash_write_enable();
-    if (response != FLASH_STATUS_SUCCESS) {
-        dprint("Failed to write-enable! [spi flash erase block]\n");
-        return response;
-    }
+    flash_contents_changed(addr, EXTERNAL_FLASH_BLOCK_SIZE);
+    return spi_flash_begin_erase(FLASH_CMD_BE, addr);
+}
 
-    /* Erase Block. */
-    response = spi_flash_transaction(FLASH_CMD_BE, addr, NULL, 0);
+flash_status_t flash_erase_block(uint32_t addr) {
+    flash_status_t response = flash_begin_erase_block(addr);
     if (response != FLASH_STATUS_SUCCESS) {
-        dprint("Failed to erase block! [spi flash erase block]\n");
+        dprint("Failed to begin erase block! [spi flash erase block]\n");
         return response;
     }
 
@@ -302,7 +329,7 @@ flash_status_t flash_read_range(uint32_t addr, void *buf, size_t len) {
     }
 
     /* Perform read. */
-    response = spi_flash_transaction(FLASH_CMD_READ, addr, read_buf, len);
+    response = spi_flash_transaction(FLASH_SPI_READ_CMD, addr, read_buf, len);
     if (response != FLASH_STATUS_SUCCESS) {
         dprint("Failed to read block! [spi flash read block]\n");
         memset(read_buf, 0, len);
@@ -320,6 +347,48 @@ flash_status_t flash_read_range(uint32_t addr, void *buf, size_t len) {
     return response;
 }
 
+flash_status_t flash_begin_write_page(uint32_t addr, const void *buf, size_t len) {
+    flash_status_t response = FLASH_STATUS_SUCCESS;
+
+    /* Check that the range stays within the page and the flash. */
+    if ((addr % EXTERNAL_FLASH_PAGE_SIZE) + len > EXTERNAL_FLASH_PAGE_SIZE || (addr + len) > (EXTERNAL_FLASH_SIZE)) {
+        dprintf("Flash write page address over limit! [addr:0x%lx]\n", (uint32_t)addr);
+        return FLASH_STATUS_BAD_ADDRESS;
+    }
+
+    /* Wait for the write-in-progress bit to be cleared. */
+    response = spi_flash_wait_while_busy();
+    if (response != FLASH_STATUS_SUCCESS) {
+        dprint("Failed to check WIP flag! [spi flash write page]\n");
+        return response;
+    }
+
+    /* Enable writes. */
+    response = spi_flash_write_enable();
+    if (response != FLASH_STATUS_SUCCESS) {
+        dprint("Failed to write-enable! [spi flash write page]\n");
+        return response;
+    }
+
+#if defined(CONSOLE_ENABLE) && defined(DEBUG_FLASH_SPI_OUTPUT)
+    dprintf("[SPI FLASH W] 0x%08lx: ", addr);
+    for (size_t i = 0; i < len; i++) {
+        dprintf(" %02X", (int)(((const uint8_t *)buf)[i]));
+    }
+    dprintf("\n");
+#endif // DEBUG_FLASH_SPI_OUTPUT
+
+    /* Perform the write. */
+    flash_contents_changed(addr, len);
+    response = spi_flash_transaction(FLASH_CMD_PP, addr, (uint8_t *)buf, len);
+    if (response != FLASH_STATUS_SUCCESS) {
+        dprint("Failed to write page! [spi flash write page]\n");
+        return response;
+    }
+
+    return response;
+}
+
 flash_status_t flash_write_range(uint32_t addr, const void *buf, size_t len) {
     flash_status_t response  = FLASH_STATUS_SUCCESS;
     uint8_t *      write_buf = (uint8_t *)buf;
@@ -331,30 +400,8 @@ flash_status_t flash_write_range(uint32_t addr, const void *buf, size_t len) {
             write_length = len;
         }
 
-        /* Wait for the write-in-progress bit to be cleared. */
-        response = spi_flash_wait_while_busy();
-        if (response != FLASH_STATUS_SUCCESS) {
-            dprint("Failed to check WIP flag! [spi flash write block]\n");
-            return response;
-        }
-
-        /* Enable writes. */
-        response = spi_flash_write_enable();
-        if (response != FLASH_STATUS_SUCCESS) {
-            dprint("Failed to write-enable! [spi flash write block]\n");
-            return response;
-        }
-
-#if defined(CONSOLE_ENABLE) && defined(DEBUG_FLASH_SPI_OUTPUT)
-        dprintf("[SPI FLASH W] 0x%08lx: ", addr);
-        for (size_t i = 0; i < write_length; i++) {
-            dprintf(" %02X", (int)(uint8_t)(write_buf[i]));
-        }
-        dprintf("\n");
-#endif // DEBUG_FLASH_SPI_OUTPUT
-
-        /* Perform the write. */
-        response = spi_flash_transaction(FLASH_CMD_PP, addr, write_buf, write_length);
+        /* Program the page, waiting for any previous page to finish first. */
+        response = flash_begin_write_page(addr, write_buf, write_length);
         if (response != FLASH_STATUS_SUCCESS) {
             dprint("Failed to write block! [spi flash write block]\n");
             return response;
@@ -58,6 +58,31 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    define EXTERNAL_FLASH_SPI_LSBFIRST false
 #endif
 
+/*
+    Whether reads should use FAST_READ instead of READ. Most chips only
+    support their highest SPI clock speeds with FAST_READ, which sends a
+    number of dummy bytes between the address and the data.
+*/
+// #define EXTERNAL_FLASH_SPI_FAST_READ
+
+/*
+    The number of dummy bytes sent after the address of a FAST_READ, as
+    specified in the datasheet.
+*/
+#ifndef EXTERNAL_FLASH_SPI_FAST_READ_DUMMY_BYTES
+#    define EXTERNAL_FLASH_SPI_FAST_READ_DUMMY_BYTES 1
+#endif
+
+/*
+    The maximum number of bytes received in one go by a read. Larger reads
+    are still performed as a single continuous transaction, and each part is
+    handed to the SPI driver as one bulk transfer, which is DMA-backed on
+    platforms that support it.
+*/
+#ifndef EXTERNAL_FLASH_SPI_MAX_TRANSFER_SIZE
+#    define EXTERNAL_FLASH_SPI_MAX_TRANSFER_SIZE 32768
+#endif
+
 /*
     The Flash address size in bytes, as specified in datasheet.
 */
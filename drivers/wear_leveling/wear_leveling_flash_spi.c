@@ -41,6 +41,19 @@ bool backing_store_erase(void) {
     return ret;
 }
 
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+bool backing_store_erase_sector(uint32_t address) {
+    uint32_t offset = (WEAR_LEVELING_EXTERNAL_FLASH_BLOCK_OFFSET) * (EXTERNAL_FLASH_BLOCK_SIZE) + address;
+    bs_dprintf("Erase sector 0x%08lX\n", (unsigned long)offset);
+    // The erase completes in the background; any subsequent flash access waits for it to finish
+    return flash_begin_erase_sector(offset) == FLASH_STATUS_SUCCESS;
+}
+
+bool backing_store_is_busy(void) {
+    return flash_is_busy() == FLASH_STATUS_BUSY;
+}
+#endif // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+
 bool backing_store_write(uint32_t address, backing_store_int_t value) {
     return backing_store_write_bulk(address, &value, 1);
 }
@@ -32,3 +32,8 @@
 #ifndef WEAR_LEVELING_LOGICAL_SIZE
 #    define WEAR_LEVELING_LOGICAL_SIZE ((WEAR_LEVELING_BACKING_SIZE) / 2)
 #endif // WEAR_LEVELING_LOGICAL_SIZE
+
+// Incremental consolidation erases one flash sector at a time
+#ifndef WEAR_LEVELING_BACKING_SECTOR_SIZE
+#    define WEAR_LEVELING_BACKING_SECTOR_SIZE (EXTERNAL_FLASH_SECTOR_SIZE)
+#endif // WEAR_LEVELING_BACKING_SECTOR_SIZE
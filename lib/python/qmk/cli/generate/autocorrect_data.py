@@ -124,6 +124,66 @@ def make_trie(autocorrections: List[Tuple[str, str]]) -> Dict[str, Any]:
     return trie
 
 
+def make_automaton(autocorrections: List[Tuple[str, str]]) -> List[Dict[str, Any]]:
+    """Makes an Aho-Corasick automaton from the typos, written forwards.
+  States are numbered in breadth first order, so that the children of each state
+  are contiguous and sorted by keycode. A state whose string ends with a typo
+  always triggers a correction, so it becomes a leaf holding the shortest such
+  typo, and anything below it is dropped. This matches the reversed trie, which
+  stops at the first leaf it reaches.
+  Args:
+    autocorrections: List of (typo, correction) tuples.
+  Returns:
+    List of states, each a dict with 'key', 'children', 'fail' and 'leaf'.
+  """
+    # Build the forward trie.
+    nodes = [{'key': 0, 'children': {}, 'leaf': None}]
+    for typo, correction in autocorrections:
+        node = 0
+        for letter in typo:
+            key = TYPO_CHARS[letter]
+            if key not in nodes[node]['children']:
+                nodes[node]['children'][key] = len(nodes)
+                nodes.append({'key': key, 'children': {}, 'leaf': None})
+            node = nodes[node]['children'][key]
+        nodes[node]['leaf'] = (typo, correction)
+
+    # Compute failure links and the shortest typo ending at each node.
+    fail = [0] * len(nodes)
+    match = [None] * len(nodes)
+    queue = [0]
+    for node in queue:
+        for key, child in sorted(nodes[node]['children'].items()):
+            if node:
+                f = fail[node]
+                while f and key not in nodes[f]['children']:
+                    f = fail[f]
+                fail[child] = nodes[f]['children'].get(key, 0)
+            match[child] = match[fail[child]] or nodes[child]['leaf']
+            queue.append(child)
+
+    # Renumber the reachable nodes, stopping at matches.
+    order = [0]
+    for node in order:
+        if not match[node]:
+            order += [child for _, child in sorted(nodes[node]['children'].items())]
+    number = {node: i for i, node in enumerate(order)}
+
+    states = []
+    for node in order:
+        f = fail[node]
+        while f not in number:  # Only possible for a leaf, which is reset after triggering.
+            f = fail[f]
+        children = [] if match[node] else [number[child] for _, child in sorted(nodes[node]['children'].items())]
+        states.append({'key': nodes[node]['key'], 'children': children, 'fail': number[f], 'leaf': match[node]})
+
+    if len(states) > 0xffff:
+        cli.log.error('{fg_red}Error:{fg_reset} The autocorrection automaton is too large, it exceeds 65535 states. Try reducing the autocorrection dict to fewer entries.')
+        maybe_exit(1)
+
+    return states
+
+
 def parse_file_lines(file_name: str) -> Iterator[Tuple[int, str, str]]:
     """Parses lines read from `file_name` into typo-correction pairs."""
 
@@ -178,19 +238,7 @@ def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any])
     # Traverse trie in depth first order.
     def traverse(trie_node):
         if 'LEAF' in trie_node:  # Handle a leaf trie node.
-            typo, correction = trie_node['LEAF']
-            word_boundary_ending = typo[-1] == ':'
-            typo = typo.strip(':')
-            i = 0  # Make the autocorrection data for this entry and serialize it.
-            while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
-                i += 1
-            backspaces = len(typo) - i - 1 + word_boundary_ending
-            assert 0 <= backspaces <= 63
-            correction = correction[i:]
-            bs_count = [backspaces + 128]
-            data = bs_count + list(bytes(correction, 'ascii')) + [0]
-
-            entry = {'data': data, 'links': [], 'byte_offset': 0}
+            entry = {'data': serialize_correction(*trie_node['LEAF']), 'links': [], 'byte_offset': 0}
             table.append(entry)
         elif len(trie_node) == 1:  # Handle trie node with a single child.
             c, trie_node = next(iter(trie_node.items()))
@@ -232,6 +280,51 @@ def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any])
     return [b for e in table for b in serialize(e)]  # Serialize final table.
 
 
+def serialize_automaton(states: List[Dict[str, Any]]) -> Tuple[List[int], List[int]]:
+    """Serializes the automaton states and their correction data in a form readable by the C code.
+  Each state is six bytes: the keycode leading to it, the number of children,
+  the failure link, then the first child, or for a leaf the offset of its
+  correction data.
+  Args:
+    states: List of states, as made by make_automaton().
+  Returns:
+    Tuple of the state table and the correction table, as lists of ints in the range 0-255.
+  """
+    corrections = []
+    table = []
+    for state in states:
+        if state['leaf']:
+            link = len(corrections)
+            corrections += serialize_correction(*state['leaf'])
+        else:
+            link = state['children'][0] if state['children'] else 0
+        table += [state['key'], len(state['children'])] + encode_offset(state['fail']) + encode_offset(link)
+
+    return table, corrections
+
+
+def serialize_correction(typo: str, correction: str) -> List[int]:
+    """Serializes the backspace count and replacement string of a single entry."""
+    word_boundary_ending = typo[-1] == ':'
+    typo = typo.strip(':')
+    i = 0
+    while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
+        i += 1
+    backspaces = len(typo) - i - 1 + word_boundary_ending
+    assert 0 <= backspaces <= 63
+    correction = correction[i:]
+    bs_count = [backspaces + 128]
+    return bs_count + list(bytes(correction, 'ascii')) + [0]
+
+
+def encode_offset(offset: int) -> List[int]:
+    """Encodes an offset as two bytes."""
+    if not (0 <= offset <= 0xffff):
+        cli.log.error('{fg_red}Error:{fg_reset} The autocorrection table is too large, an offset exceeds 64KB limit. Try reducing the autocorrection dict to fewer entries.')
+        maybe_exit(1)
+    return [offset & 255, offset >> 8]
+
+
 def encode_link(link: Dict[str, Any]) -> List[int]:
     """Encodes a node link as two bytes."""
     byte_offset = link['byte_offset']
@@ -259,6 +352,7 @@ def generate_autocorrect_data(cli):
     autocorrections = parse_file(cli.args.filename)
     trie = make_trie(autocorrections)
     data = serialize_trie(autocorrections, trie)
+    automaton, corrections = serialize_automaton(make_automaton(autocorrections))
 
     current_keyboard = cli.args.keyboard or cli.config.user.keyboard or cli.config.generate_autocorrect_data.keyboard
     current_keymap = cli.args.keymap or cli.config.user.keymap or cli.config.generate_autocorrect_data.keymap
@@ -266,7 +360,7 @@ def generate_autocorrect_data(cli):
     if current_keyboard and current_keymap:
         cli.args.output = locate_keymap(current_keyboard, current_keymap).parent / 'autocorrect_data.h'
 
-    assert all(0 <= b <= 255 for b in data)
+    assert all(0 <= b <= 255 for b in data + automaton + corrections)
 
     min_typo = min(autocorrections, key=typo_len)[0]
     max_typo = max(autocorrections, key=typo_len)[0]
@@ -286,6 +380,17 @@ def generate_autocorrect_data(cli):
     autocorrect_data_h_lines.append('static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {')
     autocorrect_data_h_lines.append(textwrap.fill('    %s' % (', '.join(map(to_hex, data))), width=100, subsequent_indent='    '))
     autocorrect_data_h_lines.append('};')
+    autocorrect_data_h_lines.append('')
+    autocorrect_data_h_lines.append(f'#define AUTOCORRECT_AUTOMATON_STATES {len(automaton) // 6}')
+    autocorrect_data_h_lines.append(f'#define AUTOCORRECT_CORRECTIONS_SIZE {len(corrections)}')
+    autocorrect_data_h_lines.append('')
+    autocorrect_data_h_lines.append('static const uint8_t autocorrect_automaton[AUTOCORRECT_AUTOMATON_STATES * 6] PROGMEM = {')
+    autocorrect_data_h_lines.append(textwrap.fill('    %s' % (', '.join(map(to_hex, automaton))), width=100, subsequent_indent='    '))
+    autocorrect_data_h_lines.append('};')
+    autocorrect_data_h_lines.append('')
+    autocorrect_data_h_lines.append('static const uint8_t autocorrect_corrections[AUTOCORRECT_CORRECTIONS_SIZE] PROGMEM = {')
+    autocorrect_data_h_lines.append(textwrap.fill('    %s' % (', '.join(map(to_hex, corrections))), width=100, subsequent_indent='    '))
+    autocorrect_data_h_lines.append('};')
 
     # Show the results
     dump_lines(cli.args.output, autocorrect_data_h_lines, cli.args.quiet)
@@ -0,0 +1,313 @@
+"""Python program to make leader_data.h.
+This program reads from a leader sequence file and generates a C source file
+"leader_data.h" with a serialized trie embedded as an array. Run this program
+and pass it as the first argument like:
+$ qmk generate-leader-data leader_sequences.txt
+Each line of the file defines one sequence of keycodes and the keycode it
+produces, with the syntax "keycodes -> result". Blank lines or lines starting
+with '#' are ignored.
+Example:
+  KC_E KC_D     -> KC_END
+  KC_S KC_S     -> LCTL(KC_S)
+  KC_G KC_I KC_T -> QK_USER_0
+Keycodes are resolved to their values here, so the table does not depend on
+anything defined in the keymap.
+For full documentation, see QMK Docs
+"""
+
+import re
+import textwrap
+from typing import Any, Dict, Iterator, List, Optional, Tuple
+
+from milc import cli
+
+from qmk.commands import dump_lines
+from qmk.constants import GPL2_HEADER_C_LIKE, GENERATED_HEADER_C_LIKE
+from qmk.keyboard import keyboard_completer, keyboard_folder
+from qmk.keycodes import load_spec
+from qmk.keymap import keymap_completer, locate_keymap
+from qmk.path import normpath
+from qmk.util import maybe_exit
+
+# Must match the node layout read by quantum/leader.c
+LEADER_NODE_LEAF = 0x8000
+LEADER_NODE_MAX_SLOTS = 0x4000
+LEADER_NODE_NONE = 0xFFFF
+LEADER_DATA_MAX_SIZE = 0xFFFF
+
+# Modifier functions, as defined in quantum/quantum_keycodes.h
+QK_LCTL, QK_LSFT, QK_LALT, QK_LGUI = 0x0100, 0x0200, 0x0400, 0x0800
+QK_RCTL, QK_RSFT, QK_RALT, QK_RGUI = 0x1100, 0x1200, 0x1400, 0x1800
+MOD_FUNCTIONS = {
+    'LCTL': QK_LCTL,
+    'C': QK_LCTL,
+    'LSFT': QK_LSFT,
+    'S': QK_LSFT,
+    'LALT': QK_LALT,
+    'A': QK_LALT,
+    'LOPT': QK_LALT,
+    'LGUI': QK_LGUI,
+    'G': QK_LGUI,
+    'LCMD': QK_LGUI,
+    'LWIN': QK_LGUI,
+    'RCTL': QK_RCTL,
+    'RSFT': QK_RSFT,
+    'RALT': QK_RALT,
+    'ALGR': QK_RALT,
+    'ROPT': QK_RALT,
+    'RGUI': QK_RGUI,
+    'RCMD': QK_RGUI,
+    'RWIN': QK_RGUI,
+    'HYPR': QK_LCTL | QK_LSFT | QK_LALT | QK_LGUI,
+    'MEH': QK_LCTL | QK_LSFT | QK_LALT,
+    'LCAG': QK_LCTL | QK_LALT | QK_LGUI,
+    'LSG': QK_LSFT | QK_LGUI,
+    'SGUI': QK_LSFT | QK_LGUI,
+    'SCMD': QK_LSFT | QK_LGUI,
+    'SWIN': QK_LSFT | QK_LGUI,
+    'LAG': QK_LALT | QK_LGUI,
+    'RSG': QK_RSFT | QK_RGUI,
+    'RAG': QK_RALT | QK_RGUI,
+    'LCA': QK_LCTL | QK_LALT,
+    'LSA': QK_LSFT | QK_LALT,
+    'RSA': QK_RSFT | QK_RALT,
+    'SAGR': QK_RSFT | QK_RALT,
+    'RCS': QK_RCTL | QK_RSFT,
+}
+
+
+def load_keycodes() -> Dict[str, int]:
+    """Maps every keycode name and alias in the latest keycode spec to its value."""
+    keycodes = {}
+    for value, keycode in load_spec('latest')['keycodes'].items():
+        for name in [keycode['key']] + keycode.get('aliases', []):
+            keycodes[name] = int(value, 16)
+
+    return keycodes
+
+
+def resolve_keycode(expression: str, keycodes: Dict[str, int]) -> Optional[int]:
+    """Resolves a keycode name, modifier function or number to its value.
+  Args:
+    expression: String, for example "KC_A", "LCTL(KC_S)" or "0x7E40".
+    keycodes: Dict of keycode names to values, as made by load_keycodes().
+  Returns:
+    The keycode value, or None if it cannot be resolved.
+  """
+    expression = expression.replace(' ', '')
+    function = re.fullmatch(r'(\w+)\((.+)\)', expression)
+    if function:
+        mods = MOD_FUNCTIONS.get(function.group(1))
+        inner = resolve_keycode(function.group(2), keycodes)
+        return None if mods is None or inner is None else mods | inner
+
+    if expression in keycodes:
+        return keycodes[expression]
+
+    try:
+        value = int(expression, 0)
+    except ValueError:
+        return None
+    return value if 0 <= value <= 0xFFFF else None
+
+
+def parse_file_lines(file_name: str) -> Iterator[Tuple[int, List[str], str]]:
+    """Parses lines read from `file_name` into sequence-result pairs."""
+
+    line_number = 0
+    for line in open(file_name, 'rt'):
+        line_number += 1
+        line = line.strip()
+        if line and line[0] != '#':
+            # Parse syntax "keycodes -> result", using strip to ignore indenting.
+            tokens = [token.strip() for token in line.split('->', 1)]
+            if len(tokens) != 2 or not tokens[0] or not tokens[1]:
+                cli.log.error('{fg_red}Error:%d:{fg_reset} Invalid syntax: "{fg_cyan}%s{fg_reset}"', line_number, line)
+                maybe_exit(1)
+                continue
+
+            sequence, result = tokens
+            yield line_number, sequence.split(), result
+
+
+def parse_file(file_name: str, keycodes: Dict[str, int]) -> List[Tuple[Tuple[str, ...], str]]:
+    """Parses the leader sequence file.
+  The function validates that each sequence is only defined once and that every
+  keycode resolves to a value. A sequence may be a prefix of another, in which
+  case it fires on timeout rather than as soon as it is typed.
+  Args:
+    file_name: String, path of the leader sequence file.
+    keycodes: Dict of keycode names to values, as made by load_keycodes().
+  Returns:
+    List of (sequence, result) tuples, with keycode names as written.
+  """
+
+    sequences = []
+    seen = {}
+    warned = set()
+    for line_number, sequence, result in parse_file_lines(file_name):
+        unresolved = [keycode for keycode in sequence + [result] if resolve_keycode(keycode, keycodes) is None]
+        if unresolved:
+            cli.log.error('{fg_red}Error:%d:{fg_reset} Unknown keycode "{fg_cyan}%s{fg_reset}". Custom keycodes are not known when the table is generated, use QK_USER_0 to QK_USER_31 instead.', line_number, unresolved[0])
+            maybe_exit(1)
+            continue
+
+        # Compare by value, so that aliases of the same keycode are caught
+        sequence = tuple(sequence)
+        values = tuple(resolve_keycode(keycode, keycodes) for keycode in sequence)
+        if values in seen:
+            cli.log.warning('{fg_red}Error:%d:{fg_reset} Ignoring duplicate sequence: "{fg_cyan}%s{fg_reset}"', line_number, ' '.join(sequence))
+            continue
+
+        for other in seen:
+            shorter = min(other, values, key=len)
+            if shorter not in warned and (other[:len(values)] == values or values[:len(other)] == other):
+                cli.log.warning('{fg_yellow}Warning:%d:{fg_reset} "{fg_cyan}%s{fg_reset}" is a prefix of another sequence and will only fire on timeout.', line_number, ' '.join(seen[shorter] if shorter in seen else sequence))
+                warned.add(shorter)
+
+        sequences.append((sequence, result))
+        seen[values] = sequence
+
+    if not sequences:
+        cli.log.error('{fg_red}Error:{fg_reset} No leader sequences found in "{fg_cyan}%s{fg_reset}".', file_name)
+        maybe_exit(1)
+
+    return sequences
+
+
+def make_trie(sequences: List[Tuple[Tuple[str, ...], str]], keycodes: Dict[str, int]) -> Dict[Any, Any]:
+    """Makes a trie from the sequences.
+  Args:
+    sequences: List of (sequence, result) tuples.
+    keycodes: Dict of keycode names to values, as made by load_keycodes().
+  Returns:
+    Dict of dict, representing the trie. Keys are keycode values, and 'LEAF' holds the result value.
+  """
+    trie = {}
+    for sequence, result in sequences:
+        node = trie
+        for keycode in sequence:
+            node = node.setdefault(resolve_keycode(keycode, keycodes), {})
+        node['LEAF'] = resolve_keycode(result, keycodes)
+
+    return trie
+
+
+def leader_slot(keycode: int, mask: int) -> int:
+    """Hashes a keycode to a child slot, the same way as quantum/leader.c."""
+    return (keycode ^ (keycode >> 8)) & mask
+
+
+def make_slots(children: List[int]) -> int:
+    """Finds the smallest power of two number of slots that holds the children without collisions."""
+    if not children:
+        return 0
+
+    slots = 1
+    while slots < len(children) or len({leader_slot(keycode, slots - 1) for keycode in children}) != len(children):
+        slots *= 2
+        if slots > LEADER_NODE_MAX_SLOTS:
+            cli.log.error('{fg_red}Error:{fg_reset} A leader sequence node has too many children.')
+            maybe_exit(1)
+            break
+
+    return slots
+
+
+def serialize_trie(trie: Dict[Any, Any]) -> List[int]:
+    """Serializes the trie in a form readable by the C code.
+  Each node is a header word holding LEADER_NODE_LEAF and the number of child
+  slots, then the result if the node is a leaf, then a (keycode, offset) pair
+  for every slot. The slot count is a power of two, and each child sits in the
+  slot its keycode hashes to, so the C code finds it with a single lookup.
+  Unused slots hold (KC_NO, LEADER_NODE_NONE).
+  Args:
+    trie: Dict of dicts.
+  Returns:
+    List of uint16_t words.
+  """
+    table = []
+
+    # Traverse trie in depth first order.
+    def traverse(trie_node):
+        children = [(keycode, child) for keycode, child in trie_node.items() if keycode != 'LEAF']
+        entry = {'leaf': trie_node.get('LEAF'), 'children': children, 'links': [], 'offset': 0}
+        entry['slots'] = make_slots([keycode for keycode, _ in children])
+        table.append(entry)
+        entry['links'] = [traverse(child) for _, child in children]
+        return entry
+
+    traverse(trie)
+
+    def node_size(e: Dict[str, Any]) -> int:
+        return 1 + (1 if e['leaf'] is not None else 0) + 2 * e['slots']
+
+    offset = 0
+    for e in table:  # To encode links, first compute the offset of each entry.
+        e['offset'] = offset
+        offset += node_size(e)
+
+    if offset > LEADER_DATA_MAX_SIZE:
+        cli.log.error('{fg_red}Error:{fg_reset} The leader sequence table is too large. Try reducing the number of sequences.')
+        maybe_exit(1)
+
+    data = []
+    for e in table:
+        data.append(e['slots'] | (LEADER_NODE_LEAF if e['leaf'] is not None else 0))
+        if e['leaf'] is not None:
+            data.append(e['leaf'])
+        slots = [(0, LEADER_NODE_NONE)] * e['slots']
+        for (keycode, _), link in zip(e['children'], e['links']):
+            slots[leader_slot(keycode, e['slots'] - 1)] = (keycode, link['offset'])
+        for keycode, link in slots:
+            data += [keycode, link]
+
+    return data
+
+
+def sequence_len(e: Tuple[Tuple[str, ...], str]) -> int:
+    return len(e[0])
+
+
+def to_hex(b: int) -> str:
+    return f'0x{b:04X}'
+
+
+@cli.argument('filename', type=normpath, help='The leader sequence file')
+@cli.argument('-kb', '--keyboard', type=keyboard_folder, completer=keyboard_completer, help='The keyboard to build a firmware for. Ignored when a configurator export is supplied.')
+@cli.argument('-km', '--keymap', completer=keymap_completer, help='The keymap to build a firmware for. Ignored when a configurator export is supplied.')
+@cli.argument('-o', '--output', arg_only=True, type=normpath, help='File to write to')
+@cli.argument('-q', '--quiet', arg_only=True, action='store_true', help="Quiet mode, only output error messages")
+@cli.subcommand('Generate the leader sequence data file from a sequence file.')
+def generate_leader_data(cli):
+    keycodes = load_keycodes()
+    sequences = parse_file(cli.args.filename, keycodes)
+    trie = make_trie(sequences, keycodes)
+    data = serialize_trie(trie)
+
+    current_keyboard = cli.args.keyboard or cli.config.user.keyboard or cli.config.generate_leader_data.keyboard
+    current_keymap = cli.args.keymap or cli.config.user.keymap or cli.config.generate_leader_data.keymap
+
+    if current_keyboard and current_keymap:
+        cli.args.output = locate_keymap(current_keyboard, current_keymap).parent / 'leader_data.h'
+
+    longest = max(sequences, key=sequence_len)[0]
+    width = max(len(' '.join(sequence)) for sequence, _ in sequences)
+
+    # Build the leader_data.h file.
+    leader_data_h_lines = [GPL2_HEADER_C_LIKE, GENERATED_HEADER_C_LIKE, '#pragma once', '']
+
+    leader_data_h_lines.append(f'// Leader sequences ({len(sequences)} entries):')
+    for sequence, result in sequences:
+        leader_data_h_lines.append(f'//   {" ".join(sequence):<{width}} -> {result}')
+
+    leader_data_h_lines.append('')
+    leader_data_h_lines.append(f'#define LEADER_DATA_MAX_LENGTH {len(longest)} // "{" ".join(longest)}"')
+    leader_data_h_lines.append(f'#define LEADER_DATA_SIZE {len(data)}')
+    leader_data_h_lines.append('')
+    leader_data_h_lines.append('static const uint16_t leader_data[LEADER_DATA_SIZE] PROGMEM = {')
+    leader_data_h_lines.append(textwrap.fill('    %s' % (', '.join(map(to_hex, data))), width=100, subsequent_indent='    '))
+    leader_data_h_lines.append('};')
+
+    # Show the results
+    dump_lines(cli.args.output, leader_data_h_lines, cli.args.quiet)
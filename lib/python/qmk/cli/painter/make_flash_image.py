@@ -0,0 +1,72 @@
+"""Bundles QGF images and QFF fonts into a binary image for external flash.
+"""
+import struct
+
+from qmk.path import normpath
+from milc import cli
+
+# Must match the asset table layout read by quantum/painter/qp_stream.c
+ASSET_TABLE_MAGIC = 0x54415051  # "QPAT"
+ASSET_TABLE_VERSION = 0x01
+ASSET_NAME_LENGTH = 24
+ASSET_TABLE_HEADER = struct.Struct('<IBBH')
+ASSET_TABLE_ENTRY = struct.Struct(f'<{ASSET_NAME_LENGTH}sII')
+
+
+@cli.argument('-o', '--output', required=True, help='Specify output binary file.')
+@cli.argument('-a', '--address', default='0', help='Flash address the image will be written to, matching QUANTUM_PAINTER_FLASH_ASSET_TABLE_ADDRESS. Default 0.')
+@cli.argument('-l', '--align', default='4', help='Alignment of each asset within the image, in bytes. Default 4.')
+@cli.argument('inputs', nargs='+', arg_only=True, help='QGF and QFF files to include, as written by the --raw option of the conversion commands.')
+@cli.subcommand('Bundles QGF images and QFF fonts into a binary image for external flash')
+def painter_make_flash_image(cli):
+    """Writes an asset table followed by the data of each input file, which can then be programmed into external flash.
+
+    Assets are named after their file name without extension, and can be looked up at runtime with `qp_flash_asset_find()`.
+    """
+    base_address = int(cli.args.address, 0)
+    align = int(cli.args.align, 0)
+    if align < 1:
+        cli.log.error('Alignment must be at least 1 byte.')
+        return False
+
+    assets = []
+    for input_file in cli.args.inputs:
+        input_file = normpath(input_file)
+        if not input_file.exists():
+            cli.log.error(f'Input file {input_file} does not exist!')
+            return False
+        if input_file.suffix.lower() not in ('.qgf', '.qff'):
+            cli.log.error(f'Input file {input_file} is not a QGF or QFF file.')
+            return False
+
+        name = input_file.stem.encode('utf-8')
+        if len(name) > ASSET_NAME_LENGTH:
+            cli.log.error(f'Asset name "{input_file.stem}" is longer than {ASSET_NAME_LENGTH} bytes.')
+            return False
+        if any(name == existing for existing, _ in assets):
+            cli.log.error(f'Asset name "{input_file.stem}" is used more than once.')
+            return False
+
+        assets.append((name, input_file.read_bytes()))
+
+    def aligned(offset):
+        return (offset + align - 1) // align * align
+
+    # Lay out the data after the table
+    table_size = ASSET_TABLE_HEADER.size + ASSET_TABLE_ENTRY.size * len(assets)
+    offset = aligned(table_size)
+    table = bytearray(ASSET_TABLE_HEADER.pack(ASSET_TABLE_MAGIC, ASSET_TABLE_VERSION, 0, len(assets)))
+    data = bytearray()
+    for name, contents in assets:
+        table += ASSET_TABLE_ENTRY.pack(name, base_address + offset, len(contents))
+        data += bytes(offset - table_size - len(data))
+        data += contents
+        cli.log.info(f'{name.decode("utf-8"):<{ASSET_NAME_LENGTH}} 0x{base_address + offset:08X} {len(contents):>8} bytes')
+        offset = aligned(offset + len(contents))
+
+    output_file = normpath(cli.args.output)
+    with open(output_file, 'wb') as output:
+        output.write(table)
+        output.write(data)
+
+    cli.log.info(f'Wrote {output_file} ({len(table) + len(data)} bytes), to be written to flash at 0x{base_address:08X}.')
@@ -1,4 +1,5 @@
 import platform
+import struct
 from subprocess import DEVNULL
 
 from milc import cli
@@ -404,3 +405,41 @@ def test_find_multiple_conditions():
     assert len(ws2812_pin_values) > 0
     for s in ws2812_pin_values:
         assert '=D3' in s
+
+
+def test_painter_make_flash_image(tmp_path):
+    (tmp_path / 'logo.qgf').write_bytes(b'\x01\x02\x03\x04\x05')
+    (tmp_path / 'font.qff').write_bytes(b'\xAA' * 20)
+    output = tmp_path / 'assets.bin'
+    result = check_subcommand('painter-make-flash-image', '-a', '0x1000', '-l', '16', '-o', str(output), str(tmp_path / 'logo.qgf'), str(tmp_path / 'font.qff'))
+    check_returncode(result)
+
+    image = output.read_bytes()
+    magic, version, _, count = struct.unpack_from('<IBBH', image, 0)
+    assert magic == 0x54415051
+    assert version == 1
+    assert count == 2
+
+    assets = [struct.unpack_from('<24sII', image, 8 + 32 * i) for i in range(count)]
+    assert [name.rstrip(b'\x00') for name, _, _ in assets] == [b'logo', b'font']
+    assert [length for _, _, length in assets] == [5, 20]
+    assert assets[0][1] == 0x1000 + 80  # 72 byte table, aligned up to 16 bytes
+    assert assets[1][1] == 0x1000 + 96
+    assert image[assets[0][1] - 0x1000:][:5] == b'\x01\x02\x03\x04\x05'
+    assert image[assets[1][1] - 0x1000:][:20] == b'\xAA' * 20
+    assert len(image) == 96 + 20
+
+
+def test_painter_make_flash_image_duplicate_name(tmp_path):
+    (tmp_path / 'logo.qgf').write_bytes(b'\x00')
+    (tmp_path / 'logo.qff').write_bytes(b'\x00')
+    result = check_subcommand('painter-make-flash-image', '-o', str(tmp_path / 'assets.bin'), str(tmp_path / 'logo.qgf'), str(tmp_path / 'logo.qff'))
+    check_returncode(result, [1])
+    assert 'used more than once' in result.stdout
+
+
+def test_painter_make_flash_image_bad_input(tmp_path):
+    (tmp_path / 'logo.png').write_bytes(b'\x00')
+    result = check_subcommand('painter-make-flash-image', '-o', str(tmp_path / 'assets.bin'), str(tmp_path / 'logo.png'))
+    check_returncode(result, [1])
+    assert 'is not a QGF or QFF file' in result.stdout
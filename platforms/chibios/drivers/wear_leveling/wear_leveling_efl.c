@@ -133,6 +133,28 @@ bool backing_store_erase(void) {
     return ret;
 }
 
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+bool backing_store_erase_sector(uint32_t address) {
+    // Sectors must be uniformly WEAR_LEVELING_BACKING_SECTOR_SIZE, so the address must land on the start of one
+    for (flash_sector_t i = 0; i < sector_count; ++i) {
+        if (flashGetSectorOffset(flash, first_sector + i) != base_offset + address) {
+            continue;
+        }
+        if (flashGetSectorSize(flash, first_sector + i) != (WEAR_LEVELING_BACKING_SECTOR_SIZE)) {
+            return false;
+        }
+
+        flash_error_t status = flashStartEraseSector(flash, first_sector + i);
+        if (status != FLASH_NO_ERROR && status != FLASH_BUSY_ERASING) {
+            return false;
+        }
+        status = flashWaitErase(flash);
+        return status == FLASH_NO_ERROR || status == FLASH_BUSY_ERASING;
+    }
+    return false;
+}
+#endif // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+
 bool backing_store_write(uint32_t address, backing_store_int_t value) {
     uint32_t offset = (base_offset + address);
     bs_dprintf("Write ");
@@ -21,6 +21,11 @@
 #    define WEAR_LEVELING_LOGICAL_SIZE ((WEAR_LEVELING_BACKING_SIZE) / 2)
 #endif // WEAR_LEVELING_LOGICAL_SIZE
 
+// Incremental consolidation erases one flash sector at a time
+#ifndef WEAR_LEVELING_BACKING_SECTOR_SIZE
+#    define WEAR_LEVELING_BACKING_SECTOR_SIZE (FLASH_SECTOR_SIZE)
+#endif // WEAR_LEVELING_BACKING_SECTOR_SIZE
+
 // Define how much flash space we have (defaults to lib/pico-sdk/src/boards/include/boards/***)
 #ifndef WEAR_LEVELING_RP2040_FLASH_SIZE
 #    define WEAR_LEVELING_RP2040_FLASH_SIZE (PICO_FLASH_SIZE_BYTES)
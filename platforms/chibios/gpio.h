@@ -43,3 +43,15 @@ typedef ioline_t pin_t;
 #define gpio_read_pin(pin) palReadLine(pin)
 
 #define gpio_toggle_pin(pin) palToggleLine(pin)
+
+/* Operation of GPIO by port, to read several pins with one register read. */
+
+#if defined(PAL_PORT) && defined(PAL_PAD)
+typedef ioportid_t   gpio_port_t;
+typedef ioportmask_t gpio_port_mask_t;
+
+#    define gpio_get_pin_port(pin) PAL_PORT(pin)
+#    define gpio_get_pin_mask(pin) PAL_PORT_BIT(PAL_PAD(pin))
+
+#    define gpio_read_port(port) palReadPort(port)
+#endif
@@ -0,0 +1,129 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <algorithm>
+#include "gtest/gtest.h"
+#include "spi_flash_emulator.hpp"
+
+extern "C" {
+#include "flash.h"
+}
+
+class FlashSpi : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        SpiFlashEmulator::Instance().reset_instance();
+        flash_init();
+    }
+
+    static std::vector<std::uint8_t> pattern(std::size_t length, std::uint8_t seed) {
+        std::vector<std::uint8_t> data(length);
+        for (std::size_t i = 0; i < length; ++i) {
+            data[i] = (std::uint8_t)(seed + i * 13);
+        }
+        return data;
+    }
+};
+
+TEST_F(FlashSpi, WriteSpanningPagesReadsBack) {
+    auto&         emu     = SpiFlashEmulator::Instance();
+    std::uint32_t address = EXTERNAL_FLASH_PAGE_SIZE - 5;
+    auto          data    = pattern(3 * EXTERNAL_FLASH_PAGE_SIZE + 7, 0x21);
+
+    EXPECT_EQ(flash_write_range(address, data.data(), data.size()), FLASH_STATUS_SUCCESS);
+    EXPECT_TRUE(std::equal(data.begin(), data.end(), emu.storage().begin() + address)) << "Page programming should not have wrapped";
+
+    std::vector<std::uint8_t> readback(data.size());
+    EXPECT_EQ(flash_read_range(address, readback.data(), readback.size()), FLASH_STATUS_SUCCESS);
+    EXPECT_EQ(readback, data);
+}
+
+TEST_F(FlashSpi, BulkReadIsSingleTransaction) {
+    auto& emu  = SpiFlashEmulator::Instance();
+    auto  data = pattern(EXTERNAL_FLASH_SIZE, 0x5A);
+    std::copy(data.begin(), data.end(), emu.storage().begin());
+
+    std::vector<std::uint8_t> readback(EXTERNAL_FLASH_SIZE);
+    EXPECT_EQ(flash_read_range(0, readback.data(), readback.size()), FLASH_STATUS_SUCCESS);
+    EXPECT_EQ(readback, data);
+    EXPECT_EQ(emu.read_transactions(), 1) << "Reads larger than the maximum transfer size should stay within one transaction";
+}
+
+TEST_F(FlashSpi, ReadUsesConfiguredCommand) {
+    auto&        emu = SpiFlashEmulator::Instance();
+    std::uint8_t value;
+    EXPECT_EQ(flash_read_range(0, &value, 1), FLASH_STATUS_SUCCESS);
+#ifdef EXTERNAL_FLASH_SPI_FAST_READ
+    EXPECT_EQ(emu.last_read_command(), 0x0B);
+#else
+    EXPECT_EQ(emu.last_read_command(), 0x03);
+#endif
+}
+
+TEST_F(FlashSpi, BeginEraseSectorReturnsWhileBusy) {
+    auto& emu = SpiFlashEmulator::Instance();
+    auto  data = pattern(2 * EXTERNAL_FLASH_SECTOR_SIZE, 0x11);
+    std::copy(data.begin(), data.end(), emu.storage().begin());
+    emu.set_busy_polls(20, 0);
+
+    EXPECT_EQ(flash_begin_erase_sector(EXTERNAL_FLASH_SECTOR_SIZE), FLASH_STATUS_SUCCESS);
+    EXPECT_TRUE(emu.is_busy()) << "Erase should not have been waited for";
+    EXPECT_EQ(flash_is_busy(), FLASH_STATUS_BUSY);
+
+    // Subsequent accesses wait for the erase to finish before issuing commands
+    std::vector<std::uint8_t> readback(2 * EXTERNAL_FLASH_SECTOR_SIZE);
+    EXPECT_EQ(flash_read_range(0, readback.data(), readback.size()), FLASH_STATUS_SUCCESS);
+    EXPECT_FALSE(emu.is_busy());
+    EXPECT_EQ(emu.commands_while_busy(), 0);
+    EXPECT_TRUE(std::equal(readback.begin(), readback.begin() + EXTERNAL_FLASH_SECTOR_SIZE, data.begin())) << "Previous sector should be untouched";
+    EXPECT_TRUE(std::all_of(readback.begin() + EXTERNAL_FLASH_SECTOR_SIZE, readback.end(), [](std::uint8_t v) { return v == 0xFF; })) << "Sector should have been erased";
+}
+
+TEST_F(FlashSpi, EraseBlockWaitsForCompletion) {
+    auto& emu = SpiFlashEmulator::Instance();
+    std::fill(emu.storage().begin(), emu.storage().end(), 0x00);
+    emu.set_busy_polls(20, 0);
+
+    EXPECT_EQ(flash_erase_block(EXTERNAL_FLASH_BLOCK_SIZE), FLASH_STATUS_SUCCESS);
+    EXPECT_FALSE(emu.is_busy()) << "Blocking erase should have waited";
+    EXPECT_EQ(emu.storage()[EXTERNAL_FLASH_BLOCK_SIZE - 1], 0x00);
+    EXPECT_EQ(emu.storage()[EXTERNAL_FLASH_BLOCK_SIZE], 0xFF);
+    EXPECT_EQ(emu.storage()[2 * EXTERNAL_FLASH_BLOCK_SIZE - 1], 0xFF);
+}
+
+TEST_F(FlashSpi, EraseBounds) {
+    EXPECT_EQ(flash_erase_sector(EXTERNAL_FLASH_SIZE - EXTERNAL_FLASH_SECTOR_SIZE), FLASH_STATUS_SUCCESS) << "Last sector should be erasable";
+    EXPECT_EQ(flash_erase_block(EXTERNAL_FLASH_SIZE - EXTERNAL_FLASH_BLOCK_SIZE), FLASH_STATUS_SUCCESS) << "Last block should be erasable";
+    EXPECT_EQ(flash_begin_erase_sector(EXTERNAL_FLASH_SIZE), FLASH_STATUS_BAD_ADDRESS);
+    EXPECT_EQ(flash_begin_erase_sector(1), FLASH_STATUS_BAD_ADDRESS);
+    EXPECT_EQ(flash_begin_erase_block(EXTERNAL_FLASH_SIZE), FLASH_STATUS_BAD_ADDRESS);
+    EXPECT_EQ(flash_begin_erase_block(EXTERNAL_FLASH_SECTOR_SIZE), FLASH_STATUS_BAD_ADDRESS);
+}
+
+TEST_F(FlashSpi, BeginWritePageStaysWithinPage) {
+    auto& emu  = SpiFlashEmulator::Instance();
+    auto  data = pattern(EXTERNAL_FLASH_PAGE_SIZE, 0x33);
+    emu.set_busy_polls(0, 10);
+
+    EXPECT_EQ(flash_begin_write_page(1, data.data(), data.size()), FLASH_STATUS_BAD_ADDRESS) << "Writes crossing a page should be rejected";
+    EXPECT_EQ(flash_begin_write_page(EXTERNAL_FLASH_PAGE_SIZE, data.data(), data.size()), FLASH_STATUS_SUCCESS);
+    EXPECT_TRUE(emu.is_busy()) << "Program should not have been waited for";
+
+    EXPECT_EQ(flash_begin_write_page(2 * EXTERNAL_FLASH_PAGE_SIZE, data.data(), data.size()), FLASH_STATUS_SUCCESS);
+    while (flash_is_busy() == FLASH_STATUS_BUSY) {
+    }
+    EXPECT_EQ(emu.commands_while_busy(), 0);
+    EXPECT_TRUE(std::equal(data.begin(), data.end(), emu.storage().begin() + EXTERNAL_FLASH_PAGE_SIZE));
+    EXPECT_TRUE(std::equal(data.begin(), data.end(), emu.storage().begin() + 2 * EXTERNAL_FLASH_PAGE_SIZE));
+}
+
+TEST_F(FlashSpi, WriteAfterAsyncEraseIsNotDropped) {
+    auto& emu  = SpiFlashEmulator::Instance();
+    auto  data = pattern(100, 0x44);
+    std::fill(emu.storage().begin(), emu.storage().end(), 0x00);
+    emu.set_busy_polls(50, 3);
+
+    EXPECT_EQ(flash_begin_erase_sector(0), FLASH_STATUS_SUCCESS);
+    EXPECT_EQ(flash_write_range(10, data.data(), data.size()), FLASH_STATUS_SUCCESS);
+    EXPECT_EQ(emu.commands_while_busy(), 0);
+    EXPECT_TRUE(std::equal(data.begin(), data.end(), emu.storage().begin() + 10));
+}
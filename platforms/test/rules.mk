@@ -23,3 +23,25 @@ eeprom_legacy_emulated_flash_SRC := \
 	$(PLATFORM_PATH)/chibios/drivers/eeprom/eeprom_legacy_emulated_flash.c
 eeprom_legacy_emulated_flash_tiny_SRC := $(eeprom_legacy_emulated_flash_SRC)
 eeprom_legacy_emulated_flash_large_SRC := $(eeprom_legacy_emulated_flash_SRC)
+
+flash_spi_DEFS := \
+	-DNO_PRINT \
+	-DEXTERNAL_FLASH_SPI_SLAVE_SELECT_PIN=0 \
+	-DEXTERNAL_FLASH_SIZE=16384 \
+	-DEXTERNAL_FLASH_BLOCK_SIZE=4096 \
+	-DEXTERNAL_FLASH_SECTOR_SIZE=1024 \
+	-DEXTERNAL_FLASH_PAGE_SIZE=64 \
+	-DEXTERNAL_FLASH_SPI_MAX_TRANSFER_SIZE=1000
+flash_spi_fast_read_DEFS := $(flash_spi_DEFS) \
+	-DEXTERNAL_FLASH_SPI_FAST_READ
+
+flash_spi_INC := \
+	$(TOP_DIR)/drivers/flash/
+flash_spi_fast_read_INC := $(flash_spi_INC)
+
+flash_spi_SRC := \
+	$(TOP_DIR)/drivers/flash/flash_spi.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/spi_flash_emulator.cpp \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/flash_spi_tests.cpp
+flash_spi_fast_read_SRC := $(flash_spi_SRC)
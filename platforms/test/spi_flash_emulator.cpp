@@ -0,0 +1,208 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <algorithm>
+#include "spi_flash_emulator.hpp"
+
+extern "C" {
+#include "spi_master.h"
+}
+
+#define FLASH_CMD_RDSR 0x05
+#define FLASH_CMD_READ 0x03
+#define FLASH_CMD_FASTREAD 0x0B
+#define FLASH_CMD_WREN 0x06
+#define FLASH_CMD_WRDI 0x04
+#define FLASH_CMD_PP 0x02
+#define FLASH_CMD_SE 0x20
+#define FLASH_CMD_BE 0xD8
+#define FLASH_CMD_CE 0x60
+
+SpiFlashEmulator SpiFlashEmulator::instance;
+
+void SpiFlashEmulator::reset_instance() {
+    std::fill(memory.begin(), memory.end(), 0xFF);
+    command.clear();
+    selected             = false;
+    ignored              = false;
+    reading              = false;
+    write_enabled        = false;
+    busy_remaining       = 0;
+    erase_busy_polls     = 0;
+    program_busy_polls   = 0;
+    cursor               = 0;
+    transaction_count    = 0;
+    read_count           = 0;
+    status_poll_count    = 0;
+    busy_violation_count = 0;
+    read_command         = 0;
+}
+
+bool SpiFlashEmulator::start() {
+    if (selected) {
+        return false;
+    }
+    selected = true;
+    ignored  = false;
+    reading  = false;
+    command.clear();
+    ++transaction_count;
+    return true;
+}
+
+void SpiFlashEmulator::stop() {
+    if (selected && !command.empty() && !ignored) {
+        complete();
+    }
+    selected = false;
+}
+
+std::size_t SpiFlashEmulator::header_size() const {
+    switch (command[0]) {
+        case FLASH_CMD_READ:
+        case FLASH_CMD_PP:
+        case FLASH_CMD_SE:
+        case FLASH_CMD_BE:
+            return 1 + EXTERNAL_FLASH_ADDRESS_SIZE;
+        case FLASH_CMD_FASTREAD:
+            return 1 + EXTERNAL_FLASH_ADDRESS_SIZE + EXTERNAL_FLASH_SPI_FAST_READ_DUMMY_BYTES;
+        default:
+            return 1;
+    }
+}
+
+std::uint32_t SpiFlashEmulator::address() const {
+    std::uint32_t addr = 0;
+    for (int i = 0; i < EXTERNAL_FLASH_ADDRESS_SIZE; ++i) {
+        addr = (addr << 8) | command[1 + i];
+    }
+    return addr % EXTERNAL_FLASH_SIZE;
+}
+
+void SpiFlashEmulator::transmit(const std::uint8_t* data, std::size_t length) {
+    if (!selected || length == 0) {
+        return;
+    }
+    if (command.empty() && busy_remaining > 0 && data[0] != FLASH_CMD_RDSR) {
+        // A real chip ignores everything but status reads while an erase or program is in progress
+        ++busy_violation_count;
+        ignored = true;
+    }
+    command.insert(command.end(), data, data + length);
+}
+
+void SpiFlashEmulator::receive(std::uint8_t* data, std::size_t length) {
+    if (!selected || command.empty() || ignored) {
+        std::fill(data, data + length, 0xFF);
+        return;
+    }
+
+    switch (command[0]) {
+        case FLASH_CMD_RDSR:
+            for (std::size_t i = 0; i < length; ++i) {
+                data[i] = (busy_remaining > 0 ? 0x01 : 0x00) | (write_enabled ? 0x02 : 0x00);
+                ++status_poll_count;
+                if (busy_remaining > 0 && --busy_remaining == 0) {
+                    write_enabled = false;
+                }
+            }
+            break;
+        case FLASH_CMD_READ:
+        case FLASH_CMD_FASTREAD:
+            if (command.size() != header_size()) {
+                // Reads with a truncated header, or stray bytes after it, return garbage on a real chip
+                std::fill(data, data + length, 0xFF);
+                break;
+            }
+            if (!reading) {
+                reading      = true;
+                cursor       = address();
+                read_command = command[0];
+                ++read_count;
+            }
+            for (std::size_t i = 0; i < length; ++i) {
+                data[i] = memory[cursor];
+                cursor  = (cursor + 1) % EXTERNAL_FLASH_SIZE;
+            }
+            break;
+        default:
+            std::fill(data, data + length, 0xFF);
+            break;
+    }
+}
+
+void SpiFlashEmulator::complete() {
+    std::uint8_t cmd = command[0];
+    switch (cmd) {
+        case FLASH_CMD_WREN:
+            write_enabled = true;
+            break;
+        case FLASH_CMD_WRDI:
+            write_enabled = false;
+            break;
+        case FLASH_CMD_PP:
+            if (write_enabled && command.size() > header_size()) {
+                std::uint32_t addr = address();
+                std::uint32_t page = addr - (addr % EXTERNAL_FLASH_PAGE_SIZE);
+                for (std::size_t i = header_size(); i < command.size(); ++i) {
+                    // Programming can only clear bits, and wraps around within the page
+                    memory[addr] &= command[i];
+                    addr = page + ((addr + 1 - page) % EXTERNAL_FLASH_PAGE_SIZE);
+                }
+                busy_remaining = program_busy_polls;
+                write_enabled  = busy_remaining > 0;
+            }
+            break;
+        case FLASH_CMD_SE:
+        case FLASH_CMD_BE:
+            if (write_enabled && command.size() == header_size()) {
+                std::uint32_t size  = (cmd == FLASH_CMD_SE) ? EXTERNAL_FLASH_SECTOR_SIZE : EXTERNAL_FLASH_BLOCK_SIZE;
+                std::uint32_t start = address() - (address() % size);
+                std::fill(memory.begin() + start, memory.begin() + start + size, 0xFF);
+                busy_remaining = erase_busy_polls;
+                write_enabled  = busy_remaining > 0;
+            }
+            break;
+        case FLASH_CMD_CE:
+            if (write_enabled) {
+                std::fill(memory.begin(), memory.end(), 0xFF);
+                busy_remaining = erase_busy_polls;
+                write_enabled  = busy_remaining > 0;
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+extern "C" {
+void spi_init(void) {}
+
+bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
+    return SpiFlashEmulator::Instance().start();
+}
+
+spi_status_t spi_write(uint8_t data) {
+    SpiFlashEmulator::Instance().transmit(&data, 1);
+    return SPI_STATUS_SUCCESS;
+}
+
+spi_status_t spi_read(void) {
+    uint8_t data;
+    SpiFlashEmulator::Instance().receive(&data, 1);
+    return data;
+}
+
+spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
+    SpiFlashEmulator::Instance().transmit(data, length);
+    return SPI_STATUS_SUCCESS;
+}
+
+spi_status_t spi_receive(uint8_t *data, uint16_t length) {
+    SpiFlashEmulator::Instance().receive(data, length);
+    return SPI_STATUS_SUCCESS;
+}
+
+void spi_stop(void) {
+    SpiFlashEmulator::Instance().stop();
+}
+} // extern "C"
@@ -0,0 +1,80 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+extern "C" {
+#include "flash_spi.h"
+}
+
+// Emulates a generic SPI NOR flash behind the test platform's spi_master API
+class SpiFlashEmulator {
+   public:
+    static SpiFlashEmulator& Instance() {
+        return instance;
+    }
+
+    void reset_instance();
+
+    // Number of status polls an erase or program reports busy for before completing
+    void set_busy_polls(std::uint32_t erase, std::uint32_t program) {
+        erase_busy_polls   = erase;
+        program_busy_polls = program;
+    }
+
+    bool is_busy() const {
+        return busy_remaining > 0;
+    }
+
+    std::vector<std::uint8_t>& storage() {
+        return memory;
+    }
+
+    std::uint64_t transactions() const {
+        return transaction_count;
+    }
+    std::uint64_t read_transactions() const {
+        return read_count;
+    }
+    std::uint64_t status_polls() const {
+        return status_poll_count;
+    }
+    std::uint64_t commands_while_busy() const {
+        return busy_violation_count;
+    }
+    std::uint8_t last_read_command() const {
+        return read_command;
+    }
+
+    // spi_master API hooks
+    bool start();
+    void stop();
+    void transmit(const std::uint8_t* data, std::size_t length);
+    void receive(std::uint8_t* data, std::size_t length);
+
+   private:
+    static SpiFlashEmulator instance;
+
+    void          complete();
+    std::size_t   header_size() const;
+    std::uint32_t address() const;
+
+    std::vector<std::uint8_t> memory = std::vector<std::uint8_t>(EXTERNAL_FLASH_SIZE, 0xFF);
+    std::vector<std::uint8_t> command;
+    bool                      selected             = false;
+    bool                      ignored              = false;
+    bool                      reading              = false;
+    bool                      write_enabled        = false;
+    std::uint32_t             busy_remaining       = 0;
+    std::uint32_t             erase_busy_polls     = 0;
+    std::uint32_t             program_busy_polls   = 0;
+    std::uint32_t             cursor               = 0;
+    std::uint64_t             transaction_count    = 0;
+    std::uint64_t             read_count           = 0;
+    std::uint64_t             status_poll_count    = 0;
+    std::uint64_t             busy_violation_count = 0;
+    std::uint8_t              read_command         = 0;
+};
@@ -243,7 +243,7 @@ void process_record_tap_hint(keyrecord_t *record) {
         return;
     }
 
-    action_t action = layer_switch_get_action(record->event.key);
+    action_t action = layer_switch_get_record_action(record);
 
     switch (action.kind.id) {
 #    ifdef SWAP_HANDS_ENABLE
@@ -290,10 +290,10 @@ void process_record_handler(keyrecord_t *record) {
     if (record->keycode) {
         action = action_for_keycode(record->keycode);
     } else {
-        action = store_or_get_action(record->event.pressed, record->event.key);
+        action = store_or_get_record_action(record);
     }
 #else
-    action_t action = store_or_get_action(record->event.pressed, record->event.key);
+    action_t action = store_or_get_record_action(record);
 #endif
     ac_dprintf("ACTION: ");
     debug_action(action);
@@ -1117,10 +1117,10 @@ bool is_tap_record(keyrecord_t *record) {
     if (record->keycode) {
         action = action_for_keycode(record->keycode);
     } else {
-        action = layer_switch_get_action(record->event.key);
+        action = layer_switch_get_record_action(record);
     }
 #else
-    action_t action = layer_switch_get_action(record->event.key);
+    action_t action = layer_switch_get_record_action(record);
 #endif
     return is_tap_action(action);
 }
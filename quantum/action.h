@@ -44,6 +44,13 @@ typedef struct {
     uint8_t count : 4;
 } tap_t;
 
+/* layer and keycode a key resolved to, valid while version matches the layer switch version */
+typedef struct {
+    uint16_t keycode;
+    uint16_t version;
+    uint8_t  layer;
+} keyresolved_t;
+
 /* Key event container for recording */
 typedef struct {
     keyevent_t event;
@@ -53,6 +60,7 @@ typedef struct {
 #if defined(COMBO_ENABLE) || defined(REPEAT_KEY_ENABLE)
     uint16_t keycode;
 #endif
+    keyresolved_t resolved;
 } keyrecord_t;
 
 /* Execute action per keyevent */
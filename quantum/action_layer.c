@@ -4,6 +4,7 @@
 #include "keyboard.h"
 #include "action.h"
 #include "encoder.h"
+#include "keymap_common.h"
 #include "util.h"
 #include "action_layer.h"
 
@@ -11,6 +12,17 @@
  */
 layer_state_t default_layer_state = 0;
 
+/** \brief Layer switch version
+ *
+ * Bumped on every layer or keymap change, so that layers and keycodes resolved into key records
+ * can be reused until then. Zero is never used, as that marks a record that was not resolved yet.
+ */
+static uint16_t layer_switch_version = 1;
+
+#ifdef DEBUG_LAYER_LOOKUPS
+static uint32_t layer_lookup_count = 0;
+#endif
+
 /** \brief Default Layer State Set At user Level
  *
  * Run user code on default layer state change
@@ -37,6 +49,7 @@ static void default_layer_state_set(layer_state_t state) {
     default_layer_debug();
     ac_dprintf(" to ");
     default_layer_state = state;
+    layer_switch_invalidate();
     default_layer_debug();
     ac_dprintf("\n");
 #if defined(STRICT_LAYER_RELEASE)
@@ -117,6 +130,7 @@ void layer_state_set(layer_state_t state) {
     layer_debug();
     ac_dprintf(" to ");
     layer_state = state;
+    layer_switch_invalidate();
     layer_debug();
     ac_dprintf("\n");
 #    if defined(STRICT_LAYER_RELEASE)
@@ -321,6 +335,9 @@ action_t store_or_get_action(bool pressed, keypos_t key) {
  * Gets the layer based on key info
  */
 uint8_t layer_switch_get_layer(keypos_t key) {
+#ifdef DEBUG_LAYER_LOOKUPS
+    layer_lookup_count++;
+#endif
 #ifndef NO_ACTION_LAYER
     action_t action;
     action.code = ACTION_TRANSPARENT;
@@ -350,6 +367,80 @@ action_t layer_switch_get_action(keypos_t key) {
     return action_for_key(layer_switch_get_layer(key), key);
 }
 
+/** \brief Layer switch invalidate
+ *
+ * Makes records look up their key again, after a layer or keymap change
+ */
+void layer_switch_invalidate(void) {
+    if (++layer_switch_version == 0) {
+        layer_switch_version = 1;
+    }
+}
+
+/** \brief Layer switch resolve record
+ *
+ * Looks up the layer and keycode of the record's key, unless it was already done since the last change
+ */
+static void layer_switch_resolve_record(keyrecord_t *record) {
+    if (record->resolved.version != layer_switch_version) {
+        record->resolved.layer   = layer_switch_get_layer(record->event.key);
+        record->resolved.keycode = keymap_key_to_keycode(record->resolved.layer, record->event.key);
+        record->resolved.version = layer_switch_version;
+    }
+}
+
+/** \brief Layer switch get record layer
+ *
+ * Gets the layer based on the record's key, reusing an earlier lookup
+ */
+uint8_t layer_switch_get_record_layer(keyrecord_t *record) {
+    layer_switch_resolve_record(record);
+    return record->resolved.layer;
+}
+
+/** \brief Layer switch get record keycode
+ *
+ * Gets the keycode based on the record's key, reusing an earlier lookup
+ */
+uint16_t layer_switch_get_record_keycode(keyrecord_t *record) {
+    layer_switch_resolve_record(record);
+    return record->resolved.keycode;
+}
+
+/** \brief Layer switch get record action
+ *
+ * Gets the action based on the record's key, reusing an earlier lookup
+ */
+action_t layer_switch_get_record_action(keyrecord_t *record) {
+    return action_for_keycode(layer_switch_get_record_keycode(record));
+}
+
+/** \brief Store or get record action
+ *
+ * Same as store_or_get_action(), reusing an earlier lookup for pressed keys
+ */
+action_t store_or_get_record_action(keyrecord_t *record) {
+#if !defined(NO_ACTION_LAYER) && !defined(STRICT_LAYER_RELEASE)
+    if (!disable_action_cache) {
+        if (!record->event.pressed) {
+            return action_for_key(read_source_layers_cache(record->event.key), record->event.key);
+        }
+        update_source_layers_cache(record->event.key, layer_switch_get_record_layer(record));
+    }
+#endif
+    return layer_switch_get_record_action(record);
+}
+
+#ifdef DEBUG_LAYER_LOOKUPS
+/** \brief Get layer lookup count
+ *
+ * Gets the number of times a key was looked up through the layer stack
+ */
+uint32_t get_layer_lookup_count(void) {
+    return layer_lookup_count;
+}
+#endif
+
 #ifndef NO_ACTION_LAYER
 layer_state_t update_tri_layer_state(layer_state_t state, uint8_t layer1, uint8_t layer2, uint8_t layer3) {
     layer_state_t mask12 = ((layer_state_t)1 << layer1) | ((layer_state_t)1 << layer2);
@@ -168,3 +168,17 @@ uint8_t layer_switch_get_layer(keypos_t key);
 
 /* return action depending on current layer status */
 action_t layer_switch_get_action(keypos_t key);
+
+/* as above, but reuse the layer and keycode already resolved into the record */
+uint8_t  layer_switch_get_record_layer(keyrecord_t *record);
+uint16_t layer_switch_get_record_keycode(keyrecord_t *record);
+action_t layer_switch_get_record_action(keyrecord_t *record);
+action_t store_or_get_record_action(keyrecord_t *record);
+
+/* invalidate the layers and keycodes resolved into records, after a layer or keymap change */
+void layer_switch_invalidate(void);
+
+#ifdef DEBUG_LAYER_LOOKUPS
+/* number of times a key was looked up through the layer stack */
+uint32_t get_layer_lookup_count(void);
+#endif
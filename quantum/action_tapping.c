@@ -1,5 +1,6 @@
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include "action.h"
 #include "action_layer.h"
@@ -15,13 +16,36 @@
 #        error "IGNORE_MOD_TAP_INTERRUPT is no longer necessary as it is now the default behavior of mod-tap keys. Please remove it from your config."
 #    endif
 
+#    if WAITING_BUFFER_SIZE < 2 || WAITING_BUFFER_SIZE > 255
+#        error "WAITING_BUFFER_SIZE must be between 2 and 255"
+#    endif
+
 #    ifndef COMBO_ENABLE
 #        define IS_TAPPING_RECORD(r) (KEYEQ(tapping_key.event.key, (r->event.key)))
 #    else
 #        define IS_TAPPING_RECORD(r) (KEYEQ(tapping_key.event.key, (r->event.key)) && tapping_key.keycode == r->keycode)
 #    endif
-#    define WITHIN_TAPPING_TERM(e) (TIMER_DIFF_16(e.time, tapping_key.event.time) < GET_TAPPING_TERM(get_record_keycode(&tapping_key, false), &tapping_key))
-#    define WITHIN_QUICK_TAP_TERM(e) (TIMER_DIFF_16(e.time, tapping_key.event.time) < GET_QUICK_TAP_TERM(get_record_keycode(&tapping_key, false), &tapping_key))
+#    define WITHIN_TAPPING_TERM(e) (TIMER_DIFF_16(e.time, tapping_key.event.time) < TAPPING_KEY_TERM)
+#    define WITHIN_QUICK_TAP_TERM(e) (TIMER_DIFF_16(e.time, tapping_key.event.time) < TAPPING_KEY_QUICK_TAP_TERM)
+
+/* The tapping key's keycode is only looked up when a per key setting needs it,
+ * and then only once each time the tapping key is set rather than on every event.
+ */
+#    if defined(TAPPING_TERM_PER_KEY) || defined(QUICK_TAP_TERM_PER_KEY) || defined(PERMISSIVE_HOLD_PER_KEY) || defined(HOLD_ON_OTHER_KEY_PRESS_PER_KEY) || (defined(AUTO_SHIFT_ENABLE) && defined(RETRO_SHIFT))
+#        define TAPPING_KEY_RESOLVE
+#    endif
+
+#    ifdef TAPPING_TERM_PER_KEY
+#        define TAPPING_KEY_TERM tapping_key_term
+#    else
+#        define TAPPING_KEY_TERM GET_TAPPING_TERM(0, &tapping_key)
+#    endif
+
+#    ifdef QUICK_TAP_TERM_PER_KEY
+#        define TAPPING_KEY_QUICK_TAP_TERM tapping_key_quick_tap_term
+#    else
+#        define TAPPING_KEY_QUICK_TAP_TERM GET_QUICK_TAP_TERM(0, &tapping_key)
+#    endif
 
 #    ifdef DYNAMIC_TAPPING_TERM_ENABLE
 uint16_t g_tapping_term = TAPPING_TERM;
@@ -63,11 +87,35 @@ static keyrecord_t tapping_key                         = {};
 static keyrecord_t waiting_buffer[WAITING_BUFFER_SIZE] = {};
 static uint8_t     waiting_buffer_head                 = 0;
 static uint8_t     waiting_buffer_tail                 = 0;
+static uint8_t     waiting_buffer_presses              = 0;
+
+/* Pending presses and releases of each matrix key, so the buffer can be asked
+ * about a key without scanning it. Events from outside the matrix, such as
+ * encoders and combos, share one count and are still found by scanning.
+ */
+static uint8_t waiting_buffer_key_presses[MATRIX_ROWS][MATRIX_COLS]  = {};
+static uint8_t waiting_buffer_key_releases[MATRIX_ROWS][MATRIX_COLS] = {};
+static uint8_t waiting_buffer_other_presses                          = 0;
+static uint8_t waiting_buffer_other_releases                         = 0;
+
+#    ifdef TAPPING_KEY_RESOLVE
+static uint16_t tapping_key_keycode = KC_NO;
+#    endif
+#    ifdef TAPPING_TERM_PER_KEY
+static uint16_t tapping_key_term = TAPPING_TERM;
+#    endif
+#    ifdef QUICK_TAP_TERM_PER_KEY
+static uint16_t tapping_key_quick_tap_term = QUICK_TAP_TERM;
+#    endif
 
 static bool process_tapping(keyrecord_t *record);
+static void tapping_key_set(const keyrecord_t *record);
+static void tapping_key_resolve(void);
+static void waiting_buffer_deq(void);
 static bool waiting_buffer_enq(keyrecord_t record);
 static void waiting_buffer_clear(void);
 static bool waiting_buffer_typed(keyevent_t event);
+static bool waiting_buffer_pending(keypos_t key, bool pressed);
 static bool waiting_buffer_has_anykey_pressed(void);
 static void waiting_buffer_scan_tap(void);
 static void debug_tapping_key(void);
@@ -98,11 +146,12 @@ void action_tapping_process(keyrecord_t record) {
     if (IS_EVENT(record.event) && waiting_buffer_head != waiting_buffer_tail) {
         ac_dprintf("---- action_exec: process waiting_buffer -----\n");
     }
-    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
+    while (waiting_buffer_tail != waiting_buffer_head) {
         if (process_tapping(&waiting_buffer[waiting_buffer_tail])) {
             ac_dprintf("processed: waiting_buffer[%u] =", waiting_buffer_tail);
             debug_record(waiting_buffer[waiting_buffer_tail]);
             ac_dprintf("\n\n");
+            waiting_buffer_deq();
         } else {
             break;
         }
@@ -116,7 +165,7 @@ void action_tapping_process(keyrecord_t record) {
  * readable. The conditional definition of tapping_keycode and all the
  * conditional uses of it are hidden inside macros named TAP_...
  */
-#    define TAP_DEFINE_KEYCODE const uint16_t tapping_keycode = get_record_keycode(&tapping_key, false)
+#    define TAP_DEFINE_KEYCODE const uint16_t tapping_keycode = tapping_key_keycode
 
 #    if defined(AUTO_SHIFT_ENABLE) && defined(RETRO_SHIFT)
 #        ifdef RETRO_TAPPING_PER_KEY
@@ -177,6 +226,7 @@ bool process_tapping(keyrecord_t *keyp) {
             ac_dprintf("Tapping: Start(Press tap key).\n");
             tapping_key = *keyp;
             process_record_tap_hint(&tapping_key);
+            tapping_key_resolve();
             waiting_buffer_scan_tap();
             debug_tapping_key();
         } else {
@@ -240,7 +290,7 @@ bool process_tapping(keyrecord_t *keyp) {
                  */
                 else if (!event.pressed && !waiting_buffer_typed(event)) {
                     // Modifier/Layer should be retained till end of this tapping.
-                    action_t action = layer_switch_get_action(event.key);
+                    action_t action = layer_switch_get_record_action(keyp);
                     switch (action.kind.id) {
                         case ACT_LMODS:
                         case ACT_RMODS:
@@ -296,7 +346,7 @@ bool process_tapping(keyrecord_t *keyp) {
                     ac_dprintf("Tapping: Tap release(%u)\n", tapping_key.tap.count);
                     keyp->tap = tapping_key.tap;
                     process_record(keyp);
-                    tapping_key = *keyp;
+                    tapping_key_set(keyp);
                     debug_tapping_key();
                     return true;
                 } else if (is_tap_record(keyp) && event.pressed) {
@@ -316,7 +366,7 @@ bool process_tapping(keyrecord_t *keyp) {
                     } else {
                         ac_dprintf("Tapping: Start while last tap(1).\n");
                     }
-                    tapping_key = *keyp;
+                    tapping_key_set(keyp);
                     waiting_buffer_scan_tap();
                     debug_tapping_key();
                     return true;
@@ -367,7 +417,7 @@ bool process_tapping(keyrecord_t *keyp) {
                     } else {
                         ac_dprintf("Tapping: Start while last timeout tap(1).\n");
                     }
-                    tapping_key = *keyp;
+                    tapping_key_set(keyp);
                     waiting_buffer_scan_tap();
                     debug_tapping_key();
                     return true;
@@ -394,17 +444,17 @@ bool process_tapping(keyrecord_t *keyp) {
                         if (keyp->tap.count < 15) keyp->tap.count += 1;
                         ac_dprintf("Tapping: Tap press(%u)\n", keyp->tap.count);
                         process_record(keyp);
-                        tapping_key = *keyp;
+                        tapping_key_set(keyp);
                         debug_tapping_key();
                         return true;
                     }
                     // FIX: start new tap again
-                    tapping_key = *keyp;
+                    tapping_key_set(keyp);
                     return true;
                 } else if (is_tap_record(keyp)) {
                     // Sequential tap can be interfered with other tap key.
                     ac_dprintf("Tapping: Start with interfering other tap.\n");
-                    tapping_key = *keyp;
+                    tapping_key_set(keyp);
                     waiting_buffer_scan_tap();
                     debug_tapping_key();
                     return true;
@@ -432,22 +482,75 @@ bool process_tapping(keyrecord_t *keyp) {
     }
 }
 
+/** \brief Set the tapping key
+ *
+ * Copies a new tapping key from the record and resolves its settings.
+ */
+static void tapping_key_set(const keyrecord_t *record) {
+    tapping_key = *record;
+    tapping_key_resolve();
+}
+
+/** \brief Resolve the tapping key settings
+ *
+ * Looks up the keycode and per key terms of the tapping key once, so that
+ * tick events and buffered keys do not repeat the layer lookup.
+ */
+static void tapping_key_resolve(void) {
+#    ifdef TAPPING_KEY_RESOLVE
+    tapping_key_keycode = get_record_keycode(&tapping_key, false);
+#    endif
+#    ifdef TAPPING_TERM_PER_KEY
+    tapping_key_term = GET_TAPPING_TERM(tapping_key_keycode, &tapping_key);
+#    endif
+#    ifdef QUICK_TAP_TERM_PER_KEY
+    tapping_key_quick_tap_term = GET_QUICK_TAP_TERM(tapping_key_keycode, &tapping_key);
+#    endif
+}
+
+/** \brief Waiting buffer next index
+ *
+ * Wraps without a division, as WAITING_BUFFER_SIZE need not be a power of two.
+ */
+static inline uint8_t waiting_buffer_next(uint8_t index) {
+    return index + 1 < WAITING_BUFFER_SIZE ? index + 1 : 0;
+}
+
+static inline bool waiting_buffer_in_matrix(keypos_t key) {
+    return key.row < MATRIX_ROWS && key.col < MATRIX_COLS;
+}
+
+/** \brief Waiting buffer key count
+ *
+ * Returns the count of pending events of the key and kind.
+ */
+static uint8_t *waiting_buffer_key_count(keypos_t key, bool pressed) {
+    if (!waiting_buffer_in_matrix(key)) {
+        return pressed ? &waiting_buffer_other_presses : &waiting_buffer_other_releases;
+    }
+    return pressed ? &waiting_buffer_key_presses[key.row][key.col] : &waiting_buffer_key_releases[key.row][key.col];
+}
+
 /** \brief Waiting buffer enq
  *
- * FIXME: Needs docs
+ * Appends a key event, keeping count of the pending presses and releases of each key.
  */
 bool waiting_buffer_enq(keyrecord_t record) {
     if (IS_NOEVENT(record.event)) {
         return true;
     }
 
-    if ((waiting_buffer_head + 1) % WAITING_BUFFER_SIZE == waiting_buffer_tail) {
+    if (waiting_buffer_next(waiting_buffer_head) == waiting_buffer_tail) {
         ac_dprintf("waiting_buffer_enq: Over flow.\n");
         return false;
     }
 
     waiting_buffer[waiting_buffer_head] = record;
-    waiting_buffer_head                 = (waiting_buffer_head + 1) % WAITING_BUFFER_SIZE;
+    waiting_buffer_head                 = waiting_buffer_next(waiting_buffer_head);
+    if (record.event.pressed) {
+        waiting_buffer_presses++;
+    }
+    (*waiting_buffer_key_count(record.event.key, record.event.pressed))++;
 
     ac_dprintf("waiting_buffer_enq: ");
     debug_waiting_buffer();
@@ -459,17 +562,55 @@ bool waiting_buffer_enq(keyrecord_t record) {
  * FIXME: Needs docs
  */
 void waiting_buffer_clear(void) {
-    waiting_buffer_head = 0;
-    waiting_buffer_tail = 0;
+    waiting_buffer_head    = 0;
+    waiting_buffer_tail    = 0;
+    waiting_buffer_presses = 0;
+    memset(waiting_buffer_key_presses, 0, sizeof(waiting_buffer_key_presses));
+    memset(waiting_buffer_key_releases, 0, sizeof(waiting_buffer_key_releases));
+    waiting_buffer_other_presses  = 0;
+    waiting_buffer_other_releases = 0;
+}
+
+/** \brief Waiting buffer deq
+ *
+ * Drops the oldest key event once it has been processed.
+ */
+static void waiting_buffer_deq(void) {
+    if (waiting_buffer_tail == waiting_buffer_head) {
+        return;
+    }
+
+    keyevent_t event = waiting_buffer[waiting_buffer_tail].event;
+    if (event.pressed) {
+        waiting_buffer_presses--;
+    }
+    (*waiting_buffer_key_count(event.key, event.pressed))--;
+    waiting_buffer_tail = waiting_buffer_next(waiting_buffer_tail);
 }
 
 /** \brief Waiting buffer typed
  *
- * FIXME: Needs docs
+ * Checks for the opposite event of the same key.
  */
 bool waiting_buffer_typed(keyevent_t event) {
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
-        if (KEYEQ(event.key, waiting_buffer[i].event.key) && event.pressed != waiting_buffer[i].event.pressed) {
+    return waiting_buffer_pending(event.key, !event.pressed);
+}
+
+/** \brief Waiting buffer pending
+ *
+ * Checks for a pending event of the key and kind, from its count for matrix
+ * keys, and by scanning only while such events from outside the matrix are pending.
+ */
+static bool waiting_buffer_pending(keypos_t key, bool pressed) {
+    if (*waiting_buffer_key_count(key, pressed) == 0) {
+        return false;
+    }
+    if (waiting_buffer_in_matrix(key)) {
+        return true;
+    }
+
+    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = waiting_buffer_next(i)) {
+        if (KEYEQ(key, waiting_buffer[i].event.key) && pressed == waiting_buffer[i].event.pressed) {
             return true;
         }
     }
@@ -478,13 +619,10 @@ bool waiting_buffer_typed(keyevent_t event) {
 
 /** \brief Waiting buffer has anykey pressed
  *
- * FIXME: Needs docs
+ * Uses the running count of pending presses.
  */
 __attribute__((unused)) bool waiting_buffer_has_anykey_pressed(void) {
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
-        if (waiting_buffer[i].event.pressed) return true;
-    }
-    return false;
+    return waiting_buffer_presses > 0;
 }
 
 /** \brief Scan buffer for tapping
@@ -495,14 +633,15 @@ void waiting_buffer_scan_tap(void) {
     // early return if:
     // - tapping already is settled
     // - invalid state: tapping_key released && tap.count == 0
-    if ((tapping_key.tap.count > 0) || !tapping_key.event.pressed) {
+    // - the tapping key has no pending release that could complete the tap
+    if ((tapping_key.tap.count > 0) || !tapping_key.event.pressed || !waiting_buffer_pending(tapping_key.event.key, false)) {
         return;
     }
 
 #    if (defined(AUTO_SHIFT_ENABLE) && defined(RETRO_SHIFT))
     TAP_DEFINE_KEYCODE;
 #    endif
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
+    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = waiting_buffer_next(i)) {
         keyrecord_t *candidate = &waiting_buffer[i];
         // clang-format off
         if (IS_EVENT(candidate->event) && KEYEQ(candidate->event.key, tapping_key.event.key) && !candidate->event.pressed && (
@@ -536,7 +675,7 @@ static void debug_tapping_key(void) {
  */
 static void debug_waiting_buffer(void) {
     ac_dprintf("{ ");
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
+    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = waiting_buffer_next(i)) {
         ac_dprintf("[%u]=", i);
         debug_record(waiting_buffer[i]);
         ac_dprintf(" ");
@@ -14,13 +14,20 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <string.h>
 #include "dynamic_keymap.h"
 #include "keymap_introspection.h"
 #include "action.h"
+#include "action_layer.h"
 #include "eeprom.h"
 #include "progmem.h"
 #include "send_string.h"
 #include "keycodes.h"
+#include "util.h"
+
+#ifdef DYNAMIC_KEYMAP_RAM_SHADOW
+#    include "timer.h"
+#endif
 
 #ifdef VIA_ENABLE
 #    include "via.h"
@@ -101,6 +108,122 @@ _Static_assert((DYNAMIC_KEYMAP_EEPROM_MAX_ADDR) - (DYNAMIC_KEYMAP_MACRO_EEPROM_A
 #    define DYNAMIC_KEYMAP_MACRO_DELAY TAP_CODE_DELAY
 #endif
 
+// Size of the blocks the macro buffer is scanned and played back in
+#ifndef DYNAMIC_KEYMAP_MACRO_READ_SIZE
+#    define DYNAMIC_KEYMAP_MACRO_READ_SIZE 32
+#endif
+// The playback buffer also holds a whole delay code (prefix, code, 4 digits, '|' and the null), and is indexed by uint8_t
+_Static_assert(DYNAMIC_KEYMAP_MACRO_READ_SIZE >= 8, "DYNAMIC_KEYMAP_MACRO_READ_SIZE must be at least 8 to hold a macro delay code.");
+_Static_assert(DYNAMIC_KEYMAP_MACRO_READ_SIZE <= 255, "DYNAMIC_KEYMAP_MACRO_READ_SIZE must be at most 255, as reads are tracked in uint8_t.");
+
+#define DYNAMIC_KEYMAP_KEYMAP_SIZE (DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2)
+#ifdef ENCODER_MAP_ENABLE
+#    define DYNAMIC_KEYMAP_ENCODER_SIZE (DYNAMIC_KEYMAP_LAYER_COUNT * NUM_ENCODERS * 2 * 2)
+#else
+#    define DYNAMIC_KEYMAP_ENCODER_SIZE 0
+#endif
+
+#ifdef DYNAMIC_KEYMAP_RAM_SHADOW
+// Maximum amount of RAM the shadow copy of the keymap and encoder map may use
+#    ifndef DYNAMIC_KEYMAP_RAM_SHADOW_MAX_SIZE
+#        define DYNAMIC_KEYMAP_RAM_SHADOW_MAX_SIZE 2048
+#    endif
+// Changes are written back to EEPROM once no further change has been made for this long
+#    ifndef DYNAMIC_KEYMAP_RAM_SHADOW_WRITE_DELAY
+#        define DYNAMIC_KEYMAP_RAM_SHADOW_WRITE_DELAY 1000
+#    endif
+
+_Static_assert(DYNAMIC_KEYMAP_KEYMAP_SIZE + DYNAMIC_KEYMAP_ENCODER_SIZE <= DYNAMIC_KEYMAP_RAM_SHADOW_MAX_SIZE, "The dynamic keymap RAM shadow exceeds DYNAMIC_KEYMAP_RAM_SHADOW_MAX_SIZE. Reduce DYNAMIC_KEYMAP_LAYER_COUNT or raise the limit.");
+
+typedef struct {
+    uint8_t *data;        // Mirror of the EEPROM bytes, big endian like the EEPROM itself
+    uint8_t *eeprom_addr; // Start of the mirrored EEPROM region
+    uint16_t size;
+    uint16_t dirty_start; // Range of bytes not yet written back, empty when start >= end
+    uint16_t dirty_end;
+} dynamic_keymap_shadow_t;
+
+static uint8_t                 keymap_shadow_data[DYNAMIC_KEYMAP_KEYMAP_SIZE];
+static dynamic_keymap_shadow_t keymap_shadow = {.data = keymap_shadow_data, .eeprom_addr = (uint8_t *)DYNAMIC_KEYMAP_EEPROM_ADDR, .size = sizeof(keymap_shadow_data)};
+#    ifdef ENCODER_MAP_ENABLE
+static uint8_t                 encoder_shadow_data[DYNAMIC_KEYMAP_ENCODER_SIZE];
+static dynamic_keymap_shadow_t encoder_shadow = {.data = encoder_shadow_data, .eeprom_addr = (uint8_t *)DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR, .size = sizeof(encoder_shadow_data)};
+#    endif
+static bool     shadow_loaded     = false;
+static uint16_t shadow_last_write = 0;
+
+static void dynamic_keymap_shadow_load(dynamic_keymap_shadow_t *shadow) {
+    eeprom_read_block(shadow->data, shadow->eeprom_addr, shadow->size);
+    shadow->dirty_start = shadow->size;
+    shadow->dirty_end   = 0;
+}
+
+static inline void dynamic_keymap_shadow_ensure_loaded(void) {
+    if (!shadow_loaded) {
+        dynamic_keymap_shadow_load(&keymap_shadow);
+#    ifdef ENCODER_MAP_ENABLE
+        dynamic_keymap_shadow_load(&encoder_shadow);
+#    endif
+        shadow_loaded = true;
+    }
+}
+
+static void dynamic_keymap_shadow_write(dynamic_keymap_shadow_t *shadow, uint16_t offset, const uint8_t *data, uint16_t size) {
+    dynamic_keymap_shadow_ensure_loaded();
+    if (memcmp(&shadow->data[offset], data, size) == 0) {
+        return;
+    }
+    memcpy(&shadow->data[offset], data, size);
+    shadow->dirty_start = MIN(shadow->dirty_start, offset);
+    shadow->dirty_end   = MAX(shadow->dirty_end, offset + size);
+    shadow_last_write   = timer_read();
+}
+
+static void dynamic_keymap_shadow_flush(dynamic_keymap_shadow_t *shadow) {
+    if (shadow->dirty_start < shadow->dirty_end) {
+        eeprom_update_block(&shadow->data[shadow->dirty_start], shadow->eeprom_addr + shadow->dirty_start, shadow->dirty_end - shadow->dirty_start);
+    }
+    shadow->dirty_start = shadow->size;
+    shadow->dirty_end   = 0;
+}
+
+/**
+ * @brief Writes any pending keymap changes back to EEPROM
+ */
+void dynamic_keymap_flush(void) {
+    if (!shadow_loaded) {
+        return;
+    }
+    dynamic_keymap_shadow_flush(&keymap_shadow);
+#    ifdef ENCODER_MAP_ENABLE
+    dynamic_keymap_shadow_flush(&encoder_shadow);
+#    endif
+}
+
+/**
+ * @brief Writes pending keymap changes back to EEPROM once they have settled
+ */
+void dynamic_keymap_task(void) {
+    bool dirty = keymap_shadow.dirty_start < keymap_shadow.dirty_end;
+#    ifdef ENCODER_MAP_ENABLE
+    dirty |= encoder_shadow.dirty_start < encoder_shadow.dirty_end;
+#    endif
+    if (dirty && timer_elapsed(shadow_last_write) >= DYNAMIC_KEYMAP_RAM_SHADOW_WRITE_DELAY) {
+        dynamic_keymap_flush();
+    }
+}
+
+/**
+ * @brief Discards the RAM shadow so that it is reloaded from EEPROM on next use
+ *
+ * Pending changes are lost, so this is only useful after the EEPROM has been rewritten behind the keymap's back.
+ */
+void dynamic_keymap_shadow_invalidate(void) {
+    shadow_loaded = false;
+    layer_switch_invalidate();
+}
+#endif // DYNAMIC_KEYMAP_RAM_SHADOW
+
 uint8_t dynamic_keymap_get_layer_count(void) {
     return DYNAMIC_KEYMAP_LAYER_COUNT;
 }
@@ -112,19 +235,32 @@ void *dynamic_keymap_key_to_eeprom_address(uint8_t layer, uint8_t row, uint8_t c
 
 uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return KC_NO;
+#ifdef DYNAMIC_KEYMAP_RAM_SHADOW
+    dynamic_keymap_shadow_ensure_loaded();
+    uint16_t offset = (layer * MATRIX_ROWS * MATRIX_COLS * 2) + (row * MATRIX_COLS * 2) + (column * 2);
+    return (keymap_shadow_data[offset] << 8) | keymap_shadow_data[offset + 1];
+#else
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
     uint16_t keycode = eeprom_read_byte(address) << 8;
     keycode |= eeprom_read_byte(address + 1);
     return keycode;
+#endif
 }
 
 void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return;
+#ifdef DYNAMIC_KEYMAP_RAM_SHADOW
+    uint16_t offset   = (layer * MATRIX_ROWS * MATRIX_COLS * 2) + (row * MATRIX_COLS * 2) + (column * 2);
+    uint8_t  bytes[2] = {(uint8_t)(keycode >> 8), (uint8_t)(keycode & 0xFF)};
+    dynamic_keymap_shadow_write(&keymap_shadow, offset, bytes, sizeof(bytes));
+#else
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
-    eeprom_update_byte(address, (uint8_t)(keycode >> 8));
-    eeprom_update_byte(address + 1, (uint8_t)(keycode & 0xFF));
+    uint8_t bytes[2] = {(uint8_t)(keycode >> 8), (uint8_t)(keycode & 0xFF)};
+    eeprom_update_block(bytes, address, sizeof(bytes));
+#endif
+    layer_switch_invalidate();
 }
 
 #ifdef ENCODER_MAP_ENABLE
@@ -134,19 +270,32 @@ void *dynamic_keymap_encoder_to_eeprom_address(uint8_t layer, uint8_t encoder_id
 
 uint16_t dynamic_keymap_get_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return KC_NO;
+#    ifdef DYNAMIC_KEYMAP_RAM_SHADOW
+    dynamic_keymap_shadow_ensure_loaded();
+    uint16_t offset = (layer * NUM_ENCODERS * 2 * 2) + (encoder_id * 2 * 2) + (clockwise ? 0 : 2);
+    return (encoder_shadow_data[offset] << 8) | encoder_shadow_data[offset + 1];
+#    else
     void *address = dynamic_keymap_encoder_to_eeprom_address(layer, encoder_id);
     // Big endian, so we can read/write EEPROM directly from host if we want
     uint16_t keycode = ((uint16_t)eeprom_read_byte(address + (clockwise ? 0 : 2))) << 8;
     keycode |= eeprom_read_byte(address + (clockwise ? 0 : 2) + 1);
     return keycode;
+#    endif
 }
 
 void dynamic_keymap_set_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise, uint16_t keycode) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return;
+#    ifdef DYNAMIC_KEYMAP_RAM_SHADOW
+    uint16_t offset   = (layer * NUM_ENCODERS * 2 * 2) + (encoder_id * 2 * 2) + (clockwise ? 0 : 2);
+    uint8_t  bytes[2] = {(uint8_t)(keycode >> 8), (uint8_t)(keycode & 0xFF)};
+    dynamic_keymap_shadow_write(&encoder_shadow, offset, bytes, sizeof(bytes));
+#    else
     void *address = dynamic_keymap_encoder_to_eeprom_address(layer, encoder_id);
     // Big endian, so we can read/write EEPROM directly from host if we want
-    eeprom_update_byte(address + (clockwise ? 0 : 2), (uint8_t)(keycode >> 8));
-    eeprom_update_byte(address + (clockwise ? 0 : 2) + 1, (uint8_t)(keycode & 0xFF));
+    uint8_t bytes[2] = {(uint8_t)(keycode >> 8), (uint8_t)(keycode & 0xFF)};
+    eeprom_update_block(bytes, address + (clockwise ? 0 : 2), sizeof(bytes));
+#    endif
+    layer_switch_invalidate();
 }
 #endif // ENCODER_MAP_ENABLE
 
@@ -165,34 +314,47 @@ void dynamic_keymap_reset(void) {
         }
 #endif // ENCODER_MAP_ENABLE
     }
+#ifdef DYNAMIC_KEYMAP_RAM_SHADOW
+    // Callers mark the EEPROM as valid straight after a reset, so it cannot be left pending
+    dynamic_keymap_flush();
+#endif
 }
 
 void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   source                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
-    uint8_t *target                     = data;
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < dynamic_keymap_eeprom_size) {
-            *target = eeprom_read_byte(source);
-        } else {
-            *target = 0x00;
-        }
-        source++;
-        target++;
+#ifdef DYNAMIC_KEYMAP_RAM_SHADOW
+    if (offset < dynamic_keymap_eeprom_size) {
+        uint16_t count = MIN(size, dynamic_keymap_eeprom_size - offset);
+        dynamic_keymap_shadow_ensure_loaded();
+        memcpy(data, &keymap_shadow_data[offset], count);
+        memset(data + count, 0x00, size - count);
+    } else {
+        memset(data, 0x00, size);
     }
+#else
+    uint16_t count = 0;
+    if (offset < dynamic_keymap_eeprom_size) {
+        void *source = (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
+        count        = MIN(size, dynamic_keymap_eeprom_size - offset);
+        eeprom_read_block(data, source, count);
+    }
+    memset(data + count, 0x00, size - count);
+#endif
 }
 
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   target                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
-    uint8_t *source                     = data;
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < dynamic_keymap_eeprom_size) {
-            eeprom_update_byte(target, *source);
-        }
-        source++;
-        target++;
+#ifdef DYNAMIC_KEYMAP_RAM_SHADOW
+    if (offset < dynamic_keymap_eeprom_size) {
+        dynamic_keymap_shadow_write(&keymap_shadow, offset, data, MIN(size, dynamic_keymap_eeprom_size - offset));
+    }
+#else
+    if (offset < dynamic_keymap_eeprom_size) {
+        void *target = (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
+        eeprom_update_block(data, target, MIN(size, dynamic_keymap_eeprom_size - offset));
     }
+#endif
+    layer_switch_invalidate();
 }
 
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
@@ -220,38 +382,87 @@ uint16_t dynamic_keymap_macro_get_buffer_size(void) {
 }
 
 void dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   source = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
-    uint8_t *target = data;
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
-            *target = eeprom_read_byte(source);
-        } else {
-            *target = 0x00;
+    uint16_t count = 0;
+    if (offset < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
+        void *source = (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
+        count        = MIN(size, DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE - offset);
+        eeprom_read_block(data, source, count);
+    }
+    memset(data + count, 0x00, size - count);
+}
+
+// Offset of each macro string within the macro buffer, so that playback
+// does not have to scan the EEPROM for the Nth null terminator. Offsets of
+// DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE mark macros missing from the buffer.
+static uint16_t macro_offsets[DYNAMIC_KEYMAP_MACRO_COUNT];
+static bool     macro_index_valid = false;
+
+static void dynamic_keymap_macro_build_index(void) {
+    uint8_t buffer[DYNAMIC_KEYMAP_MACRO_READ_SIZE];
+    uint8_t id = 0;
+    if (id < DYNAMIC_KEYMAP_MACRO_COUNT) {
+        macro_offsets[id++] = 0;
+    }
+    for (uint16_t offset = 0; offset < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE && id < DYNAMIC_KEYMAP_MACRO_COUNT; offset += sizeof(buffer)) {
+        uint16_t count = MIN(sizeof(buffer), DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE - offset);
+        eeprom_read_block(buffer, (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset), count);
+        for (uint16_t i = 0; i < count && id < DYNAMIC_KEYMAP_MACRO_COUNT; i++) {
+            if (buffer[i] == 0) {
+                macro_offsets[id++] = offset + i + 1;
+            }
         }
-        source++;
-        target++;
     }
+    while (id < DYNAMIC_KEYMAP_MACRO_COUNT) {
+        macro_offsets[id++] = DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE;
+    }
+    macro_index_valid = true;
 }
 
 void dynamic_keymap_macro_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   target = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
-    uint8_t *source = data;
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
-            eeprom_update_byte(target, *source);
+    if (offset < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
+        void *   target = (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
+        uint16_t count  = MIN(size, DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE - offset);
+        eeprom_update_block(data, target, count);
+
+        // Hosts clear the last byte of the buffer once the transfer is complete,
+        // which is the point at which the index can be rebuilt
+        macro_index_valid = false;
+        if (count > 0 && offset + count == DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE && data[count - 1] == 0) {
+            dynamic_keymap_macro_build_index();
         }
-        source++;
-        target++;
     }
 }
 
 void dynamic_keymap_macro_reset(void) {
-    void *p   = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR);
-    void *end = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE);
-    while (p != end) {
-        eeprom_update_byte(p, 0);
-        ++p;
+    // Clear in small chunks, so that the update only writes out pages that are not already empty
+    uint8_t zeros[32] = {0};
+    for (uint16_t offset = 0; offset < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE; offset += sizeof(zeros)) {
+        void *target = (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
+        eeprom_update_block(zeros, target, MIN(sizeof(zeros), DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE - offset));
     }
+    macro_index_valid = false;
+}
+
+typedef struct {
+    uint16_t offset; // Offset within the macro buffer of the next read
+    uint8_t  position;
+    uint8_t  length;
+    uint8_t  buffer[DYNAMIC_KEYMAP_MACRO_READ_SIZE];
+} dynamic_keymap_macro_reader_t;
+
+// Returns the next byte of the macro buffer, reading ahead in blocks
+static uint8_t dynamic_keymap_macro_read(dynamic_keymap_macro_reader_t *reader) {
+    if (reader->position >= reader->length) {
+        // The buffer is known to end with a null, so running off its end terminates the macro
+        if (reader->offset >= DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
+            return 0;
+        }
+        reader->length = MIN(sizeof(reader->buffer), DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE - reader->offset);
+        eeprom_read_block(reader->buffer, (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + reader->offset), reader->length);
+        reader->offset += reader->length;
+        reader->position = 0;
+    }
+    return reader->buffer[reader->position++];
 }
 
 void dynamic_keymap_macro_send(uint8_t id) {
@@ -268,71 +479,79 @@ void dynamic_keymap_macro_send(uint8_t id) {
         return;
     }
 
-    // Skip N null characters
-    // p will then point to the Nth macro
-    p         = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR);
-    void *end = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE);
-    while (id > 0) {
-        // If we are past the end of the buffer, then there is
-        // no Nth macro in the buffer.
-        if (p == end) {
-            return;
-        }
-        if (eeprom_read_byte(p) == 0) {
-            --id;
-        }
-        ++p;
+    if (!macro_index_valid) {
+        dynamic_keymap_macro_build_index();
+    }
+    // If the offset is past the end of the buffer, then there is
+    // no Nth macro in the buffer.
+    if (macro_offsets[id] >= DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
+        return;
     }
+    dynamic_keymap_macro_reader_t reader = {.offset = macro_offsets[id]};
 
     // Send the macro string by making a temporary string.
-    char data[8] = {0};
-    // We already checked there was a null at the end of
-    // the buffer, so this cannot go past the end
+    // Runs of plain characters are sent together, up to the size of the string.
+    char    data[DYNAMIC_KEYMAP_MACRO_READ_SIZE + 1];
+    uint8_t length = 0;
     while (1) {
-        data[0] = eeprom_read_byte(p++);
-        data[1] = 0;
+        char c = dynamic_keymap_macro_read(&reader);
+        if (c != 0 && c != SS_QMK_PREFIX) {
+            data[length++] = c;
+            if (length < sizeof(data) - 1) {
+                continue;
+            }
+        }
+        if (length > 0) {
+            data[length] = 0;
+            send_string_with_delay(data, DYNAMIC_KEYMAP_MACRO_DELAY);
+            length = 0;
+        }
         // Stop at the null terminator of this macro string
-        if (data[0] == 0) {
+        if (c == 0) {
             break;
         }
-        if (data[0] == SS_QMK_PREFIX) {
-            // Get the code
-            data[1] = eeprom_read_byte(p++);
+        if (c != SS_QMK_PREFIX) {
+            continue;
+        }
+
+        data[0] = c;
+        // Get the code
+        data[1] = dynamic_keymap_macro_read(&reader);
+        data[2] = 0;
+        // Unexpected null, abort.
+        if (data[1] == 0) {
+            return;
+        }
+        if (data[1] == SS_TAP_CODE || data[1] == SS_DOWN_CODE || data[1] == SS_UP_CODE) {
+            // Get the keycode
+            data[2] = dynamic_keymap_macro_read(&reader);
             // Unexpected null, abort.
-            if (data[1] == 0) {
+            if (data[2] == 0) {
                 return;
             }
-            if (data[1] == SS_TAP_CODE || data[1] == SS_DOWN_CODE || data[1] == SS_UP_CODE) {
-                // Get the keycode
-                data[2] = eeprom_read_byte(p++);
-                // Unexpected null, abort.
-                if (data[2] == 0) {
+            // Null terminate
+            data[3] = 0;
+        } else if (data[1] == SS_DELAY_CODE) {
+            // Get the number and '|'
+            // At most this is 4 digits plus '|'
+            uint8_t i = 2;
+            while (1) {
+                data[i] = dynamic_keymap_macro_read(&reader);
+                // Unexpected null, abort
+                if (data[i] == 0) {
                     return;
                 }
-                // Null terminate
-                data[3] = 0;
-            } else if (data[1] == SS_DELAY_CODE) {
-                // Get the number and '|'
-                // At most this is 4 digits plus '|'
-                uint8_t i = 2;
-                while (1) {
-                    data[i] = eeprom_read_byte(p++);
-                    // Unexpected null, abort
-                    if (data[i] == 0) {
-                        return;
-                    }
-                    // Found '|', send it
-                    if (data[i] == '|') {
-                        data[i + 1] = 0;
-                        break;
-                    }
-                    // If haven't found '|' by i==6 then
-                    // number too big, abort
-                    if (i == 6) {
-                        return;
-                    }
-                    ++i;
+                // Found '|', send it
+                if (data[i] == '|') {
+                    data[i + 1] = 0;
+                    break;
+                }
+                // If haven't found '|' by i==6 then
+                // number too big, abort
+                if (i == 6) {
+                    return;
                 }
+                ++i;
             }
         }
         send_string_with_delay(data, DYNAMIC_KEYMAP_MACRO_DELAY);
@@ -38,6 +38,14 @@ void dynamic_keymap_reset(void);
 void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data);
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data);
 
+#ifdef DYNAMIC_KEYMAP_RAM_SHADOW
+// With DYNAMIC_KEYMAP_RAM_SHADOW, lookups are served from a RAM copy of the keymap and encoder map.
+// Changes are written back to EEPROM by dynamic_keymap_task() once they settle, or by dynamic_keymap_flush().
+void dynamic_keymap_task(void);
+void dynamic_keymap_flush(void);
+void dynamic_keymap_shadow_invalidate(void);
+#endif // DYNAMIC_KEYMAP_RAM_SHADOW
+
 // This overrides the one in quantum/keymap_common.c
 // uint16_t keymap_key_to_keycode(uint8_t layer, keypos_t key);
 
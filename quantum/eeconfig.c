@@ -12,6 +12,13 @@
 #    include "haptic.h"
 #endif
 
+#if defined(EECONFIG_WRITE_BEHIND)
+#    include "timer.h"
+#    if defined(VIA_ENABLE)
+#        include "via.h"
+#    endif
+#endif
+
 #if defined(VIA_ENABLE)
 bool via_eeprom_is_valid(void);
 void via_eeprom_set_valid(bool valid);
@@ -20,6 +27,179 @@ void eeconfig_init_via(void);
 
 _Static_assert((intptr_t)EECONFIG_HANDEDNESS == 14, "EEPROM handedness offset is incorrect");
 
+#if defined(EECONFIG_WRITE_BEHIND)
+// Region of EEPROM mirrored in RAM, starting from address 0
+#    ifndef EECONFIG_WRITE_BEHIND_SIZE
+#        if defined(VIA_ENABLE)
+#            define EECONFIG_WRITE_BEHIND_SIZE (VIA_EEPROM_CONFIG_END)
+#        else
+#            define EECONFIG_WRITE_BEHIND_SIZE (EECONFIG_SIZE)
+#        endif
+#    endif
+// Pending writes are flushed once no further write has been made for this long
+#    ifndef EECONFIG_WRITE_BEHIND_DELAY
+#        define EECONFIG_WRITE_BEHIND_DELAY 2000
+#    endif
+
+static uint8_t  write_behind_data[EECONFIG_WRITE_BEHIND_SIZE];
+static uint8_t  write_behind_dirty[((EECONFIG_WRITE_BEHIND_SIZE) + 7) / 8];
+static bool     write_behind_loaded  = false;
+static bool     write_behind_pending = false;
+static uint16_t write_behind_last_write;
+
+static inline bool write_behind_is_dirty(uint16_t addr) {
+    return write_behind_dirty[addr / 8] & (1 << (addr % 8));
+}
+
+static inline void write_behind_ensure_loaded(void) {
+    if (!write_behind_loaded) {
+        eeprom_read_block(write_behind_data, (const void *)0, sizeof(write_behind_data));
+        memset(write_behind_dirty, 0, sizeof(write_behind_dirty));
+        write_behind_pending = false;
+        write_behind_loaded  = true;
+    }
+}
+
+static inline bool write_behind_overlaps(uintptr_t addr, size_t len, uintptr_t region, size_t region_len) {
+    return addr < region + region_len && region < addr + len;
+}
+
+/** \brief Decides whether a write to the given range may be held in RAM
+ *
+ * Returning false writes the range, along with everything pending before it, straight to EEPROM.
+ * By default the validity markers are never delayed, so they only reach EEPROM after the data they cover.
+ */
+__attribute__((weak)) bool eeconfig_write_behind_may_defer_user(uintptr_t addr, size_t len) {
+    return true;
+}
+
+__attribute__((weak)) bool eeconfig_write_behind_may_defer_kb(uintptr_t addr, size_t len) {
+    if (write_behind_overlaps(addr, len, (uintptr_t)EECONFIG_MAGIC, sizeof(uint16_t))) {
+        return false;
+    }
+#    if defined(VIA_ENABLE)
+    if (write_behind_overlaps(addr, len, (uintptr_t)(VIA_EEPROM_MAGIC_ADDR), 3)) {
+        return false;
+    }
+#    endif
+    return eeconfig_write_behind_may_defer_user(addr, len);
+}
+
+/** \brief Writes all pending changes to EEPROM
+ *
+ * Adjacent dirty bytes are written as one block.
+ */
+void eeconfig_write_behind_flush(void) {
+    if (!write_behind_pending) {
+        return;
+    }
+    uint16_t addr = 0;
+    while (addr < (EECONFIG_WRITE_BEHIND_SIZE)) {
+        if (!write_behind_is_dirty(addr)) {
+            addr++;
+            continue;
+        }
+        uint16_t start = addr;
+        while (addr < (EECONFIG_WRITE_BEHIND_SIZE) && write_behind_is_dirty(addr)) {
+            addr++;
+        }
+        eeprom_update_block(&write_behind_data[start], (void *)(uintptr_t)start, addr - start);
+    }
+    memset(write_behind_dirty, 0, sizeof(write_behind_dirty));
+    write_behind_pending = false;
+}
+
+/** \brief Flushes pending changes once writes have gone quiet
+ *
+ * Called from the main loop.
+ */
+void eeconfig_write_behind_task(void) {
+    if (write_behind_pending && timer_elapsed(write_behind_last_write) >= (EECONFIG_WRITE_BEHIND_DELAY)) {
+        eeconfig_write_behind_flush();
+    }
+}
+
+/** \brief Drops the RAM copy and any pending changes
+ *
+ * Needed when the EEPROM is changed underneath the cache, such as after a format.
+ */
+void eeconfig_write_behind_invalidate(void) {
+    write_behind_loaded  = false;
+    write_behind_pending = false;
+}
+
+void eeconfig_read_block(void *dst, const void *src, size_t len) {
+    uintptr_t addr = (uintptr_t)src;
+    if (addr >= (EECONFIG_WRITE_BEHIND_SIZE)) {
+        eeprom_read_block(dst, src, len);
+        return;
+    }
+    size_t cached = MIN(len, (EECONFIG_WRITE_BEHIND_SIZE) - addr);
+    write_behind_ensure_loaded();
+    memcpy(dst, &write_behind_data[addr], cached);
+    if (cached < len) {
+        eeprom_read_block((uint8_t *)dst + cached, (const uint8_t *)src + cached, len - cached);
+    }
+}
+
+void eeconfig_update_block(const void *src, void *dst, size_t len) {
+    uintptr_t addr = (uintptr_t)dst;
+    if (addr >= (EECONFIG_WRITE_BEHIND_SIZE)) {
+        // Keep writes in order with anything still pending
+        eeconfig_write_behind_flush();
+        eeprom_update_block(src, dst, len);
+        return;
+    }
+    size_t         cached = MIN(len, (EECONFIG_WRITE_BEHIND_SIZE) - addr);
+    const uint8_t *data   = (const uint8_t *)src;
+    write_behind_ensure_loaded();
+    for (size_t i = 0; i < cached; i++) {
+        if (write_behind_data[addr + i] != data[i]) {
+            write_behind_data[addr + i] = data[i];
+            write_behind_dirty[(addr + i) / 8] |= 1 << ((addr + i) % 8);
+            write_behind_pending = true;
+            write_behind_last_write = timer_read();
+        }
+    }
+    if (cached < len || !eeconfig_write_behind_may_defer_kb(addr, cached)) {
+        eeconfig_write_behind_flush();
+    }
+    if (cached < len) {
+        eeprom_update_block(data + cached, (uint8_t *)dst + cached, len - cached);
+    }
+}
+
+uint8_t eeconfig_read_byte(const uint8_t *addr) {
+    uint8_t ret = 0;
+    eeconfig_read_block(&ret, addr, sizeof(ret));
+    return ret;
+}
+
+uint16_t eeconfig_read_word(const uint16_t *addr) {
+    uint16_t ret = 0;
+    eeconfig_read_block(&ret, addr, sizeof(ret));
+    return ret;
+}
+
+uint32_t eeconfig_read_dword(const uint32_t *addr) {
+    uint32_t ret = 0;
+    eeconfig_read_block(&ret, addr, sizeof(ret));
+    return ret;
+}
+
+void eeconfig_update_byte(uint8_t *addr, uint8_t value) {
+    eeconfig_update_block(&value, addr, sizeof(value));
+}
+
+void eeconfig_update_word(uint16_t *addr, uint16_t value) {
+    eeconfig_update_block(&value, addr, sizeof(value));
+}
+
+void eeconfig_update_dword(uint32_t *addr, uint32_t value) {
+    eeconfig_update_block(&value, addr, sizeof(value));
+}
+#endif // EECONFIG_WRITE_BEHIND
+
 /** \brief eeconfig enable
  *
  * FIXME: needs doc
@@ -47,21 +227,26 @@ void eeconfig_init_quantum(void) {
 #if defined(EEPROM_DRIVER)
     eeprom_driver_format(false);
 #endif
+#if defined(EECONFIG_WRITE_BEHIND)
+    eeconfig_write_behind_invalidate();
+#endif
 
-    eeprom_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER);
-    eeprom_update_byte(EECONFIG_DEBUG, 0);
+    eeconfig_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER);
+    eeconfig_update_byte(EECONFIG_DEBUG, 0);
     default_layer_state = (layer_state_t)1 << 0;
+    layer_switch_invalidate();
     eeconfig_update_default_layer(default_layer_state);
     // Enable oneshot and autocorrect by default: 0b0001 0100 0000 0000
-    eeprom_update_word(EECONFIG_KEYMAP, 0x1400);
-    eeprom_update_byte(EECONFIG_BACKLIGHT, 0);
-    eeprom_update_byte(EECONFIG_AUDIO, 0);
-    eeprom_update_dword(EECONFIG_RGBLIGHT, 0);
-    eeprom_update_byte(EECONFIG_RGBLIGHT_EXTENDED, 0);
-    eeprom_update_byte(EECONFIG_UNICODEMODE, 0);
-    eeprom_update_byte(EECONFIG_STENOMODE, 0);
-    eeprom_write_qword(EECONFIG_RGB_MATRIX, 0);
-    eeprom_update_dword(EECONFIG_HAPTIC, 0);
+    eeconfig_update_word(EECONFIG_KEYMAP, 0x1400);
+    eeconfig_update_byte(EECONFIG_BACKLIGHT, 0);
+    eeconfig_update_byte(EECONFIG_AUDIO, 0);
+    eeconfig_update_dword(EECONFIG_RGBLIGHT, 0);
+    eeconfig_update_byte(EECONFIG_RGBLIGHT_EXTENDED, 0);
+    eeconfig_update_byte(EECONFIG_UNICODEMODE, 0);
+    eeconfig_update_byte(EECONFIG_STENOMODE, 0);
+    uint64_t rgb_matrix = 0;
+    eeconfig_update_block(&rgb_matrix, EECONFIG_RGB_MATRIX, sizeof(rgb_matrix));
+    eeconfig_update_dword(EECONFIG_HAPTIC, 0);
 #if defined(HAPTIC_ENABLE)
     haptic_reset();
 #endif
@@ -83,6 +268,11 @@ void eeconfig_init_quantum(void) {
 #endif
 
     eeconfig_init_kb();
+
+#if defined(EECONFIG_WRITE_BEHIND)
+    // A freshly initialised EEPROM should not be left half written
+    eeconfig_write_behind_flush();
+#endif
 }
 
 /** \brief eeconfig initialization
@@ -98,7 +288,7 @@ void eeconfig_init(void) {
  * FIXME: needs doc
  */
 void eeconfig_enable(void) {
-    eeprom_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER);
+    eeconfig_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER);
 }
 
 /** \brief eeconfig disable
@@ -106,10 +296,17 @@ void eeconfig_enable(void) {
  * FIXME: needs doc
  */
 void eeconfig_disable(void) {
+#if defined(EECONFIG_WRITE_BEHIND)
+    // Pending writes go out before the magic, so they are not lost along with the RAM copy
+    eeconfig_write_behind_flush();
+#endif
 #if defined(EEPROM_DRIVER)
     eeprom_driver_format(false);
 #endif
-    eeprom_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER_OFF);
+#if defined(EECONFIG_WRITE_BEHIND)
+    eeconfig_write_behind_invalidate();
+#endif
+    eeconfig_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER_OFF);
 }
 
 /** \brief eeconfig is enabled
@@ -117,7 +314,7 @@ void eeconfig_disable(void) {
  * FIXME: needs doc
  */
 bool eeconfig_is_enabled(void) {
-    bool is_eeprom_enabled = (eeprom_read_word(EECONFIG_MAGIC) == EECONFIG_MAGIC_NUMBER);
+    bool is_eeprom_enabled = (eeconfig_read_word(EECONFIG_MAGIC) == EECONFIG_MAGIC_NUMBER);
 #ifdef VIA_ENABLE
     if (is_eeprom_enabled) {
         is_eeprom_enabled = via_eeprom_is_valid();
@@ -131,7 +328,7 @@ bool eeconfig_is_enabled(void) {
  * FIXME: needs doc
  */
 bool eeconfig_is_disabled(void) {
-    bool is_eeprom_disabled = (eeprom_read_word(EECONFIG_MAGIC) == EECONFIG_MAGIC_NUMBER_OFF);
+    bool is_eeprom_disabled = (eeconfig_read_word(EECONFIG_MAGIC) == EECONFIG_MAGIC_NUMBER_OFF);
 #ifdef VIA_ENABLE
     if (!is_eeprom_disabled) {
         is_eeprom_disabled = !via_eeprom_is_valid();
@@ -145,14 +342,14 @@ bool eeconfig_is_disabled(void) {
  * FIXME: needs doc
  */
 uint8_t eeconfig_read_debug(void) {
-    return eeprom_read_byte(EECONFIG_DEBUG);
+    return eeconfig_read_byte(EECONFIG_DEBUG);
 }
 /** \brief eeconfig update debug
  *
  * FIXME: needs doc
  */
 void eeconfig_update_debug(uint8_t val) {
-    eeprom_update_byte(EECONFIG_DEBUG, val);
+    eeconfig_update_byte(EECONFIG_DEBUG, val);
 }
 
 /** \brief eeconfig read default layer
@@ -160,7 +357,7 @@ void eeconfig_update_debug(uint8_t val) {
  * FIXME: needs doc
  */
 layer_state_t eeconfig_read_default_layer(void) {
-    uint8_t val = eeprom_read_byte(EECONFIG_DEFAULT_LAYER);
+    uint8_t val = eeconfig_read_byte(EECONFIG_DEFAULT_LAYER);
 
 #ifdef DEFAULT_LAYER_STATE_IS_VALUE_NOT_BITMASK
     // stored as a layer number, so convert back to bitmask
@@ -183,7 +380,7 @@ void eeconfig_update_default_layer(layer_state_t state) {
     uint8_t val = state;
 #endif
 
-    eeprom_update_byte(EECONFIG_DEFAULT_LAYER, val);
+    eeconfig_update_byte(EECONFIG_DEFAULT_LAYER, val);
 }
 
 /** \brief eeconfig read keymap
@@ -191,14 +388,14 @@ void eeconfig_update_default_layer(layer_state_t state) {
  * FIXME: needs doc
  */
 uint16_t eeconfig_read_keymap(void) {
-    return eeprom_read_word(EECONFIG_KEYMAP);
+    return eeconfig_read_word(EECONFIG_KEYMAP);
 }
 /** \brief eeconfig update keymap
  *
  * FIXME: needs doc
  */
 void eeconfig_update_keymap(uint16_t val) {
-    eeprom_update_word(EECONFIG_KEYMAP, val);
+    eeconfig_update_word(EECONFIG_KEYMAP, val);
 }
 
 /** \brief eeconfig read audio
@@ -206,14 +403,14 @@ void eeconfig_update_keymap(uint16_t val) {
  * FIXME: needs doc
  */
 uint8_t eeconfig_read_audio(void) {
-    return eeprom_read_byte(EECONFIG_AUDIO);
+    return eeconfig_read_byte(EECONFIG_AUDIO);
 }
 /** \brief eeconfig update audio
  *
  * FIXME: needs doc
  */
 void eeconfig_update_audio(uint8_t val) {
-    eeprom_update_byte(EECONFIG_AUDIO, val);
+    eeconfig_update_byte(EECONFIG_AUDIO, val);
 }
 
 #if (EECONFIG_KB_DATA_SIZE) == 0
@@ -222,14 +419,14 @@ void eeconfig_update_audio(uint8_t val) {
  * FIXME: needs doc
  */
 uint32_t eeconfig_read_kb(void) {
-    return eeprom_read_dword(EECONFIG_KEYBOARD);
+    return eeconfig_read_dword(EECONFIG_KEYBOARD);
 }
 /** \brief eeconfig update kb
  *
  * FIXME: needs doc
  */
 void eeconfig_update_kb(uint32_t val) {
-    eeprom_update_dword(EECONFIG_KEYBOARD, val);
+    eeconfig_update_dword(EECONFIG_KEYBOARD, val);
 }
 #endif // (EECONFIG_KB_DATA_SIZE) == 0
 
@@ -239,14 +436,14 @@ void eeconfig_update_kb(uint32_t val) {
  * FIXME: needs doc
  */
 uint32_t eeconfig_read_user(void) {
-    return eeprom_read_dword(EECONFIG_USER);
+    return eeconfig_read_dword(EECONFIG_USER);
 }
 /** \brief eeconfig update user
  *
  * FIXME: needs doc
  */
 void eeconfig_update_user(uint32_t val) {
-    eeprom_update_dword(EECONFIG_USER, val);
+    eeconfig_update_dword(EECONFIG_USER, val);
 }
 #endif // (EECONFIG_USER_DATA_SIZE) == 0
 
@@ -255,14 +452,14 @@ void eeconfig_update_user(uint32_t val) {
  * FIXME: needs doc
  */
 uint32_t eeconfig_read_haptic(void) {
-    return eeprom_read_dword(EECONFIG_HAPTIC);
+    return eeconfig_read_dword(EECONFIG_HAPTIC);
 }
 /** \brief eeconfig update haptic
  *
  * FIXME: needs doc
  */
 void eeconfig_update_haptic(uint32_t val) {
-    eeprom_update_dword(EECONFIG_HAPTIC, val);
+    eeconfig_update_dword(EECONFIG_HAPTIC, val);
 }
 
 /** \brief eeconfig read split handedness
@@ -270,14 +467,14 @@ void eeconfig_update_haptic(uint32_t val) {
  * FIXME: needs doc
  */
 bool eeconfig_read_handedness(void) {
-    return !!eeprom_read_byte(EECONFIG_HANDEDNESS);
+    return !!eeconfig_read_byte(EECONFIG_HANDEDNESS);
 }
 /** \brief eeconfig update split handedness
  *
  * FIXME: needs doc
  */
 void eeconfig_update_handedness(bool val) {
-    eeprom_update_byte(EECONFIG_HANDEDNESS, !!val);
+    eeconfig_update_byte(EECONFIG_HANDEDNESS, !!val);
 }
 
 #if (EECONFIG_KB_DATA_SIZE) > 0
@@ -286,7 +483,7 @@ void eeconfig_update_handedness(bool val) {
  * FIXME: needs doc
  */
 bool eeconfig_is_kb_datablock_valid(void) {
-    return eeprom_read_dword(EECONFIG_KEYBOARD) == (EECONFIG_KB_DATA_VERSION);
+    return eeconfig_read_dword(EECONFIG_KEYBOARD) == (EECONFIG_KB_DATA_VERSION);
 }
 /** \brief eeconfig read keyboard data block
  *
@@ -294,7 +491,7 @@ bool eeconfig_is_kb_datablock_valid(void) {
  */
 void eeconfig_read_kb_datablock(void *data) {
     if (eeconfig_is_kb_datablock_valid()) {
-        eeprom_read_block(data, EECONFIG_KB_DATABLOCK, (EECONFIG_KB_DATA_SIZE));
+        eeconfig_read_block(data, EECONFIG_KB_DATABLOCK, (EECONFIG_KB_DATA_SIZE));
     } else {
         memset(data, 0, (EECONFIG_KB_DATA_SIZE));
     }
@@ -304,8 +501,8 @@ void eeconfig_read_kb_datablock(void *data) {
  * FIXME: needs doc
  */
 void eeconfig_update_kb_datablock(const void *data) {
-    eeprom_update_dword(EECONFIG_KEYBOARD, (EECONFIG_KB_DATA_VERSION));
-    eeprom_update_block(data, EECONFIG_KB_DATABLOCK, (EECONFIG_KB_DATA_SIZE));
+    eeconfig_update_dword(EECONFIG_KEYBOARD, (EECONFIG_KB_DATA_VERSION));
+    eeconfig_update_block(data, EECONFIG_KB_DATABLOCK, (EECONFIG_KB_DATA_SIZE));
 }
 /** \brief eeconfig init keyboard data block
  *
@@ -323,7 +520,7 @@ __attribute__((weak)) void eeconfig_init_kb_datablock(void) {
  * FIXME: needs doc
  */
 bool eeconfig_is_user_datablock_valid(void) {
-    return eeprom_read_dword(EECONFIG_USER) == (EECONFIG_USER_DATA_VERSION);
+    return eeconfig_read_dword(EECONFIG_USER) == (EECONFIG_USER_DATA_VERSION);
 }
 /** \brief eeconfig read user data block
  *
@@ -331,7 +528,7 @@ bool eeconfig_is_user_datablock_valid(void) {
  */
 void eeconfig_read_user_datablock(void *data) {
     if (eeconfig_is_user_datablock_valid()) {
-        eeprom_read_block(data, EECONFIG_USER_DATABLOCK, (EECONFIG_USER_DATA_SIZE));
+        eeconfig_read_block(data, EECONFIG_USER_DATABLOCK, (EECONFIG_USER_DATA_SIZE));
     } else {
         memset(data, 0, (EECONFIG_USER_DATA_SIZE));
     }
@@ -341,8 +538,8 @@ void eeconfig_read_user_datablock(void *data) {
  * FIXME: needs doc
  */
 void eeconfig_update_user_datablock(const void *data) {
-    eeprom_update_dword(EECONFIG_USER, (EECONFIG_USER_DATA_VERSION));
-    eeprom_update_block(data, EECONFIG_USER_DATABLOCK, (EECONFIG_USER_DATA_SIZE));
+    eeconfig_update_dword(EECONFIG_USER, (EECONFIG_USER_DATA_VERSION));
+    eeconfig_update_block(data, EECONFIG_USER_DATABLOCK, (EECONFIG_USER_DATA_SIZE));
 }
 /** \brief eeconfig init user data block
  *
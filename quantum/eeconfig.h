@@ -108,6 +108,34 @@ typedef struct PACKED {
 #define EECONFIG_KEYMAP_SWAP_BACKSLASH_BACKSPACE (1 << 6)
 #define EECONFIG_KEYMAP_NKRO (1 << 7)
 
+#ifdef EECONFIG_WRITE_BEHIND
+// Accessors for the eeconfig region. With EECONFIG_WRITE_BEHIND, updates are held in RAM and
+// written back once they settle, so anything stored below EECONFIG_WRITE_BEHIND_SIZE must use these.
+uint8_t  eeconfig_read_byte(const uint8_t *addr);
+uint16_t eeconfig_read_word(const uint16_t *addr);
+uint32_t eeconfig_read_dword(const uint32_t *addr);
+void     eeconfig_read_block(void *dst, const void *src, size_t len);
+void     eeconfig_update_byte(uint8_t *addr, uint8_t value);
+void     eeconfig_update_word(uint16_t *addr, uint16_t value);
+void     eeconfig_update_dword(uint32_t *addr, uint32_t value);
+void     eeconfig_update_block(const void *src, void *dst, size_t len);
+
+void eeconfig_write_behind_task(void);
+void eeconfig_write_behind_flush(void);
+void eeconfig_write_behind_invalidate(void);
+bool eeconfig_write_behind_may_defer_kb(uintptr_t addr, size_t len);
+bool eeconfig_write_behind_may_defer_user(uintptr_t addr, size_t len);
+#else
+#    define eeconfig_read_byte(addr) eeprom_read_byte(addr)
+#    define eeconfig_read_word(addr) eeprom_read_word(addr)
+#    define eeconfig_read_dword(addr) eeprom_read_dword(addr)
+#    define eeconfig_read_block(dst, src, len) eeprom_read_block(dst, src, len)
+#    define eeconfig_update_byte(addr, value) eeprom_update_byte(addr, value)
+#    define eeconfig_update_word(addr, value) eeprom_update_word(addr, value)
+#    define eeconfig_update_dword(addr, value) eeprom_update_dword(addr, value)
+#    define eeconfig_update_block(src, dst, len) eeprom_update_block(src, dst, len)
+#endif // EECONFIG_WRITE_BEHIND
+
 bool eeconfig_is_enabled(void);
 bool eeconfig_is_disabled(void);
 
@@ -178,13 +206,13 @@ void eeconfig_init_user_datablock(void);
     static inline void eeconfig_init_##name(void) {                     \
         dirty_##name = true;                                            \
         if (eeconfig_check_valid_##name()) {                            \
-            eeprom_read_block(&config, offset, sizeof(config));         \
+            eeconfig_read_block(&config, offset, sizeof(config));       \
             dirty_##name = false;                                       \
         }                                                               \
     }                                                                   \
     static inline void eeconfig_flush_##name(bool force) {              \
         if (force || dirty_##name) {                                    \
-            eeprom_update_block(&config, offset, sizeof(config));       \
+            eeconfig_update_block(&config, offset, sizeof(config));     \
             eeconfig_post_flush_##name();                               \
             dirty_##name = false;                                       \
         }                                                               \
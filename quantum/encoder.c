@@ -6,44 +6,169 @@
 #include "encoder.h"
 #include "wait.h"
 
+#if defined(ENCODER_MAP_ENABLE) && defined(ENCODER_MAP_BATCHING)
+#    include "action_layer.h"
+#    include "keymap_common.h"
+#    include "host.h"
+#    ifdef MOUSEKEY_ENABLE
+#        include "mousekey.h"
+#    endif
+#endif
+
 #ifndef ENCODER_MAP_KEY_DELAY
 #    define ENCODER_MAP_KEY_DELAY TAP_CODE_DELAY
 #endif
 
+#ifndef ENCODER_MAP_BATCH_MAX
+#    define ENCODER_MAP_BATCH_MAX 32
+#endif
+
 __attribute__((weak)) bool should_process_encoder(void) {
     return is_keyboard_master();
 }
 
+// Each queue is single-producer/single-consumer: only the producer moves `head`, only the consumer moves `tail`.
+// This lets the encoder driver enqueue from an interrupt while the main loop drains without masking interrupts.
+// Events read from the other half are enqueued from the main loop, so they get a queue of their own.
+#ifndef ENCODER_QUEUE_FENCE
+#    define ENCODER_QUEUE_FENCE() __atomic_signal_fence(__ATOMIC_SEQ_CST)
+#endif
+#define ENCODER_QUEUE_SHARED(x) (*(volatile uint8_t *)&(x))
+
 static encoder_events_t encoder_events;
-static bool             signal_queue_drain = false;
+#ifdef SPLIT_KEYBOARD
+static encoder_events_t encoder_split_events;
+#endif // SPLIT_KEYBOARD
+static volatile bool     signal_queue_drain     = false;
+static volatile uint8_t  signal_drain_tail      = 0;
+static volatile uint8_t  signal_drain_dequeued  = 0;
+static volatile uint16_t encoder_overflow_count = 0;
 
 void encoder_init(void) {
     memset(&encoder_events, 0, sizeof(encoder_events));
+#ifdef SPLIT_KEYBOARD
+    memset(&encoder_split_events, 0, sizeof(encoder_split_events));
+#endif // SPLIT_KEYBOARD
+    encoder_overflow_count = 0;
     encoder_driver_init();
 }
 
-static void encoder_queue_drain(void) {
-    encoder_events.tail     = encoder_events.head;
-    encoder_events.dequeued = encoder_events.enqueued;
+// Releases the events the master has read, leaving anything the interrupt has queued since then for its next read
+static void encoder_queue_drain(uint8_t tail, uint8_t dequeued) {
+    uint8_t queued   = (ENCODER_QUEUE_SHARED(encoder_events.head) + MAX_QUEUED_ENCODER_EVENTS - encoder_events.tail) % MAX_QUEUED_ENCODER_EVENTS;
+    uint8_t released = (tail + MAX_QUEUED_ENCODER_EVENTS - encoder_events.tail) % MAX_QUEUED_ENCODER_EVENTS;
+    if (released > queued) {
+        return; // stale, or not from this queue
+    }
+
+    ENCODER_QUEUE_FENCE();
+    encoder_events.dequeued                   = dequeued;
+    ENCODER_QUEUE_SHARED(encoder_events.tail) = tail;
 }
 
-static bool encoder_handle_queue(void) {
-    bool    changed = false;
-    uint8_t index;
-    bool    clockwise;
-    while (encoder_dequeue_event(&index, &clockwise)) {
 #ifdef ENCODER_MAP_ENABLE
-
-        // The delays below cater for Windows and its wonderful requirements.
-        action_exec(clockwise ? MAKE_ENCODER_CW_EVENT(index, true) : MAKE_ENCODER_CCW_EVENT(index, true));
+static void encoder_exec_mapping(uint8_t index, bool clockwise) {
+    // The delays below cater for Windows and its wonderful requirements.
+    action_exec(clockwise ? MAKE_ENCODER_CW_EVENT(index, true) : MAKE_ENCODER_CCW_EVENT(index, true));
 #    if ENCODER_MAP_KEY_DELAY > 0
-        wait_ms(ENCODER_MAP_KEY_DELAY);
+    wait_ms(ENCODER_MAP_KEY_DELAY);
 #    endif // ENCODER_MAP_KEY_DELAY > 0
 
-        action_exec(clockwise ? MAKE_ENCODER_CW_EVENT(index, false) : MAKE_ENCODER_CCW_EVENT(index, false));
+    action_exec(clockwise ? MAKE_ENCODER_CW_EVENT(index, false) : MAKE_ENCODER_CCW_EVENT(index, false));
 #    if ENCODER_MAP_KEY_DELAY > 0
-        wait_ms(ENCODER_MAP_KEY_DELAY);
+    wait_ms(ENCODER_MAP_KEY_DELAY);
 #    endif // ENCODER_MAP_KEY_DELAY > 0
+}
+
+#    ifdef ENCODER_MAP_BATCHING
+static bool encoder_peek_event(encoder_events_t *events, uint8_t *index, bool *clockwise);
+
+__attribute__((weak)) bool encoder_batch_update_user(uint8_t index, bool clockwise, uint16_t keycode, uint8_t count) {
+    return true;
+}
+
+__attribute__((weak)) bool encoder_batch_update_kb(uint8_t index, bool clockwise, uint16_t keycode, uint8_t count) {
+    return encoder_batch_update_user(index, clockwise, keycode, count);
+}
+
+/**
+ * @brief Dispatches a run of same-direction detents as a single action
+ *
+ * Mouse wheel keycodes are sent as one mousekey report carrying the combined delta. Consumer keycodes are tapped on the
+ * host report once per detent. Neither goes through process_record, so encoder_batch_update_kb() is the only hook that
+ * sees them; ENCODER_MAP_BATCHING is opt-in for that reason. Anything else is left for per-detent handling.
+ *
+ * @param[in] index uint8_t encoder index
+ * @param[in] clockwise bool
+ * @param[in] count uint8_t number of detents
+ * @return true if the detents were handled
+ */
+static bool encoder_exec_batch(uint8_t index, bool clockwise, uint8_t count) {
+    keypos_t key     = MAKE_KEYPOS(clockwise ? KEYLOC_ENCODER_CW : KEYLOC_ENCODER_CCW, index);
+    uint16_t keycode = keymap_key_to_keycode(layer_switch_get_layer(key), key);
+
+    if (!encoder_batch_update_kb(index, clockwise, keycode, count)) {
+        return true;
+    }
+
+#        ifdef MOUSEKEY_ENABLE
+    if (IS_MOUSEKEY_WHEEL(keycode)) {
+        mousekey_wheel_send(keycode, count);
+        return true;
+    }
+#        endif // MOUSEKEY_ENABLE
+
+#        ifdef EXTRAKEY_ENABLE
+    if (IS_CONSUMER_KEYCODE(keycode)) {
+        // Consumer usages carry no magnitude, so each detent is still a press and release, minus process_record.
+        // The release puts back whatever usage was held before; if that is the same usage, tap it by releasing first.
+        uint16_t usage    = KEYCODE2CONSUMER(keycode);
+        uint16_t previous = host_last_consumer_usage();
+        uint16_t press    = previous == usage ? 0 : usage;
+        uint16_t release  = previous == usage ? usage : previous;
+        for (uint8_t i = 0; i < count; i++) {
+            host_consumer_send(press);
+#            if ENCODER_MAP_KEY_DELAY > 0
+            wait_ms(ENCODER_MAP_KEY_DELAY);
+#            endif // ENCODER_MAP_KEY_DELAY > 0
+            host_consumer_send(release);
+#            if ENCODER_MAP_KEY_DELAY > 0
+            wait_ms(ENCODER_MAP_KEY_DELAY);
+#            endif // ENCODER_MAP_KEY_DELAY > 0
+        }
+        return true;
+    }
+#        endif // EXTRAKEY_ENABLE
+
+    return false;
+}
+#    endif // ENCODER_MAP_BATCHING
+#endif     // ENCODER_MAP_ENABLE
+
+static bool encoder_handle_queue(encoder_events_t *events) {
+    bool    changed = false;
+    uint8_t index;
+    bool    clockwise;
+    while (encoder_dequeue_event_advanced(events, &index, &clockwise)) {
+#ifdef ENCODER_MAP_ENABLE
+        uint8_t count = 1;
+
+#    ifdef ENCODER_MAP_BATCHING
+        // Collapse the run of consecutive detents in the same direction on the same encoder
+        uint8_t next_index;
+        bool    next_clockwise;
+        while (count < ENCODER_MAP_BATCH_MAX && encoder_peek_event(events, &next_index, &next_clockwise) && next_index == index && next_clockwise == clockwise) {
+            encoder_dequeue_event_advanced(events, &next_index, &next_clockwise);
+            count++;
+        }
+        if (encoder_exec_batch(index, clockwise, count)) {
+            count = 0;
+        }
+#    endif // ENCODER_MAP_BATCHING
+
+        for (uint8_t i = 0; i < count; i++) {
+            encoder_exec_mapping(index, clockwise);
+        }
 
 #else // ENCODER_MAP_ENABLE
 
@@ -60,15 +185,15 @@ bool encoder_task(void) {
     bool changed = false;
 
 #ifdef SPLIT_KEYBOARD
-    // Attempt to process existing encoder events in case split handling has already enqueued events
+    // Process the events split handling has already enqueued from the other half
     if (should_process_encoder()) {
-        changed |= encoder_handle_queue();
+        changed |= encoder_handle_queue(&encoder_split_events);
     }
 #endif // SPLIT_KEYBOARD
 
     if (signal_queue_drain) {
         signal_queue_drain = false;
-        encoder_queue_drain();
+        encoder_queue_drain(signal_drain_tail, signal_drain_dequeued);
     }
 
     // Let the encoder driver produce events
@@ -76,14 +201,14 @@ bool encoder_task(void) {
 
     // Process any events that were enqueued
     if (should_process_encoder()) {
-        changed |= encoder_handle_queue();
+        changed |= encoder_handle_queue(&encoder_events);
     }
 
     return changed;
 }
 
 bool encoder_queue_full_advanced(encoder_events_t *events) {
-    return events->tail == (events->head + 1) % MAX_QUEUED_ENCODER_EVENTS;
+    return ENCODER_QUEUE_SHARED(events->tail) == (events->head + 1) % MAX_QUEUED_ENCODER_EVENTS;
 }
 
 bool encoder_queue_full(void) {
@@ -91,7 +216,7 @@ bool encoder_queue_full(void) {
 }
 
 bool encoder_queue_empty_advanced(encoder_events_t *events) {
-    return events->head == events->tail;
+    return ENCODER_QUEUE_SHARED(events->head) == events->tail;
 }
 
 bool encoder_queue_empty(void) {
@@ -108,9 +233,10 @@ bool encoder_queue_event_advanced(encoder_events_t *events, uint8_t index, bool
     encoder_event_t new_event   = {.index = index, .clockwise = clockwise ? 1 : 0};
     events->queue[events->head] = new_event;
 
-    // Increment the head index
-    events->head = (events->head + 1) % MAX_QUEUED_ENCODER_EVENTS;
+    // Publish the event only once it has been written
+    ENCODER_QUEUE_FENCE();
     events->enqueued++;
+    ENCODER_QUEUE_SHARED(events->head) = (events->head + 1) % MAX_QUEUED_ENCODER_EVENTS;
 
     return true;
 }
@@ -119,23 +245,63 @@ bool encoder_dequeue_event_advanced(encoder_events_t *events, uint8_t *index, bo
     if (encoder_queue_empty_advanced(events)) {
         return false;
     }
+    ENCODER_QUEUE_FENCE();
 
     // Retrieve the event
     encoder_event_t event = events->queue[events->tail];
     *index                = event.index;
     *clockwise            = event.clockwise;
 
-    // Increment the tail index
-    events->tail = (events->tail + 1) % MAX_QUEUED_ENCODER_EVENTS;
+    // Release the slot only once it has been read
+    ENCODER_QUEUE_FENCE();
     events->dequeued++;
+    ENCODER_QUEUE_SHARED(events->tail) = (events->tail + 1) % MAX_QUEUED_ENCODER_EVENTS;
 
     return true;
 }
 
+#if defined(ENCODER_MAP_ENABLE) && defined(ENCODER_MAP_BATCHING)
+static bool encoder_peek_event(encoder_events_t *events, uint8_t *index, bool *clockwise) {
+    if (encoder_queue_empty_advanced(events)) {
+        return false;
+    }
+    ENCODER_QUEUE_FENCE();
+
+    encoder_event_t event = events->queue[events->tail];
+    *index                = event.index;
+    *clockwise            = event.clockwise;
+    return true;
+}
+#endif // defined(ENCODER_MAP_ENABLE) && defined(ENCODER_MAP_BATCHING)
+
 bool encoder_queue_event(uint8_t index, bool clockwise) {
-    return encoder_queue_event_advanced(&encoder_events, index, clockwise);
+    if (!encoder_queue_event_advanced(&encoder_events, index, clockwise)) {
+        // Keep track of lost detents rather than dropping them silently
+        if (encoder_overflow_count < UINT16_MAX) {
+            encoder_overflow_count++;
+        }
+        return false;
+    }
+    return true;
 }
 
+#ifdef SPLIT_KEYBOARD
+bool encoder_queue_split_events(encoder_events_t *events) {
+    uint8_t queued = (events->head + MAX_QUEUED_ENCODER_EVENTS - events->tail) % MAX_QUEUED_ENCODER_EVENTS;
+    uint8_t used   = (encoder_split_events.head + MAX_QUEUED_ENCODER_EVENTS - encoder_split_events.tail) % MAX_QUEUED_ENCODER_EVENTS;
+    if (queued > MAX_QUEUED_ENCODER_EVENTS - 1 - used) {
+        return false;
+    }
+
+    uint8_t index;
+    bool    clockwise;
+    while (encoder_dequeue_event_advanced(events, &index, &clockwise)) {
+        encoder_queue_event_advanced(&encoder_split_events, index, clockwise);
+    }
+    return true;
+}
+#endif // SPLIT_KEYBOARD
+
 bool encoder_dequeue_event(uint8_t *index, bool *clockwise) {
     return encoder_dequeue_event_advanced(&encoder_events, index, clockwise);
 }
@@ -144,8 +310,14 @@ void encoder_retrieve_events(encoder_events_t *events) {
     memcpy(events, &encoder_events, sizeof(encoder_events));
 }
 
-void encoder_signal_queue_drain(void) {
-    signal_queue_drain = true;
+uint16_t encoder_get_overflow_count(void) {
+    return encoder_overflow_count;
+}
+
+void encoder_signal_queue_drain(uint8_t tail, uint8_t dequeued) {
+    signal_drain_tail     = tail;
+    signal_drain_dequeued = dequeued;
+    signal_queue_drain    = true;
 }
 
 __attribute__((weak)) bool encoder_update_user(uint8_t index, bool clockwise) {
@@ -106,18 +106,38 @@ void encoder_retrieve_events(encoder_events_t *events);
 bool encoder_queue_event_advanced(encoder_events_t *events, uint8_t index, bool clockwise);
 bool encoder_dequeue_event_advanced(encoder_events_t *events, uint8_t *index, bool *clockwise);
 
-// Reset the queue to be empty
-void encoder_signal_queue_drain(void);
+// Release the events the other half has read, up to its tail and dequeued count
+void encoder_signal_queue_drain(uint8_t tail, uint8_t dequeued);
+
+#    ifdef SPLIT_KEYBOARD
+// Move all events read from the other half onto this half's queue, from the main loop only
+// Returns false, taking none of them, if they do not all fit
+bool encoder_queue_split_events(encoder_events_t *events);
+#    endif // SPLIT_KEYBOARD
+
+// Number of events dropped because the queue was full, saturating
+uint16_t encoder_get_overflow_count(void);
 
 #    ifdef ENCODER_MAP_ENABLE
 #        define NUM_DIRECTIONS 2
 #        define ENCODER_CCW_CW(ccw, cw) \
             { (cw), (ccw) }
 extern const uint16_t encoder_map[][NUM_ENCODERS][NUM_DIRECTIONS];
-#    endif // ENCODER_MAP_ENABLE
+
+#        ifdef ENCODER_MAP_BATCHING
+// Called with each run of same-direction detents, return false to skip the built-in handling
+bool encoder_batch_update_kb(uint8_t index, bool clockwise, uint16_t keycode, uint8_t count);
+bool encoder_batch_update_user(uint8_t index, bool clockwise, uint16_t keycode, uint8_t count);
+#        endif // ENCODER_MAP_BATCHING
+#    endif     // ENCODER_MAP_ENABLE
 
 // "Custom encoder lite" support
 void encoder_driver_init(void);
 void encoder_driver_task(void);
 
+#    ifdef ENCODER_INTERRUPT_ENABLE
+// Samples all encoder pins and queues any resulting events, to be called from a pin-change interrupt
+void encoder_quadrature_isr(void);
+#    endif // ENCODER_INTERRUPT_ENABLE
+
 #endif // ENCODER_ENABLE
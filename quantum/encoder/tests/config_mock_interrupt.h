@@ -0,0 +1,25 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+#include "config_encoder_common.h"
+
+#define MATRIX_ROWS 1
+#define MATRIX_COLS 1
+
+#define ENCODER_INTERRUPT_ENABLE
+
+/* Here, "pins" from 0 to 31 are allowed. */
+#define ENCODER_A_PINS \
+    { 0 }
+#define ENCODER_B_PINS \
+    { 1 }
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "mock.h"
+
+#ifdef __cplusplus
+};
+#endif
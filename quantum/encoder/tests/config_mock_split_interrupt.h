@@ -0,0 +1,32 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+#include "config_encoder_common.h"
+
+#define MATRIX_ROWS 1
+#define MATRIX_COLS 1
+
+/* Here, "pins" from 0 to 31 are allowed. */
+#define ENCODER_INTERRUPT_ENABLE
+
+// The interrupt is simulated on another thread, so the queues need a hardware fence rather than a compiler fence
+#define ENCODER_QUEUE_FENCE() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+#define ENCODER_A_PINS \
+    { 0, 2 }
+#define ENCODER_B_PINS \
+    { 1, 3 }
+#define ENCODER_A_PINS_RIGHT \
+    { 4, 6 }
+#define ENCODER_B_PINS_RIGHT \
+    { 5, 7 }
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "mock_split.h"
+
+#ifdef __cplusplus
+};
+#endif
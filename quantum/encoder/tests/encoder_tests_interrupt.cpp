@@ -0,0 +1,91 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include <vector>
+#include <algorithm>
+#include <stdio.h>
+
+extern "C" {
+#include "encoder.h"
+#include "encoder/tests/mock.h"
+}
+
+struct update {
+    int8_t index;
+    bool   clockwise;
+};
+
+uint8_t updates_array_idx = 0;
+update  updates[32];
+
+bool encoder_update_kb(uint8_t index, bool clockwise) {
+    updates[updates_array_idx % 32] = {index, clockwise};
+    updates_array_idx++;
+    return true;
+}
+
+// Simulates a pin-change interrupt firing for the transition
+void setAndInterrupt(pin_t pin, bool val) {
+    setPin(pin, val);
+    encoder_quadrature_isr();
+}
+
+void oneClockwise(void) {
+    setAndInterrupt(0, false);
+    setAndInterrupt(1, false);
+    setAndInterrupt(0, true);
+    setAndInterrupt(1, true);
+}
+
+class EncoderInterruptTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        updates_array_idx = 0;
+        encoder_init();
+    }
+};
+
+TEST_F(EncoderInterruptTest, TaskDoesNotPoll) {
+    setPin(0, false);
+    encoder_task();
+    setPin(1, false);
+    encoder_task();
+    setPin(0, true);
+    encoder_task();
+    setPin(1, true);
+    encoder_task();
+
+    EXPECT_EQ(updates_array_idx, 0);
+}
+
+TEST_F(EncoderInterruptTest, TaskDrainsInterruptEvents) {
+    oneClockwise();
+    EXPECT_EQ(updates_array_idx, 0);
+
+    EXPECT_TRUE(encoder_task());
+    EXPECT_EQ(updates_array_idx, 1);
+    EXPECT_EQ(updates[0].index, 0);
+    EXPECT_EQ(updates[0].clockwise, true);
+
+    EXPECT_FALSE(encoder_task());
+    EXPECT_EQ(updates_array_idx, 1);
+}
+
+TEST_F(EncoderInterruptTest, OverflowIsCounted) {
+    // The queue holds one less than its size
+    for (uint8_t i = 0; i < MAX_QUEUED_ENCODER_EVENTS + 1; i++) {
+        oneClockwise();
+    }
+    EXPECT_EQ(encoder_get_overflow_count(), 2);
+
+    encoder_task();
+    EXPECT_EQ(updates_array_idx, MAX_QUEUED_ENCODER_EVENTS - 1);
+
+    // Space freed by the drain is usable again
+    oneClockwise();
+    encoder_task();
+    EXPECT_EQ(updates_array_idx, MAX_QUEUED_ENCODER_EVENTS);
+    EXPECT_EQ(encoder_get_overflow_count(), 2);
+}
@@ -0,0 +1,163 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include <atomic>
+#include <cstring>
+#include <thread>
+
+extern "C" {
+#include "encoder.h"
+#include "keyboard.h"
+#include "encoder/tests/mock_split.h"
+}
+
+uint32_t updates[NUM_ENCODERS];
+
+bool isMaster;
+bool isLeftHand;
+
+bool is_keyboard_master(void) {
+    return isMaster;
+}
+
+bool encoder_update_kb(uint8_t index, bool clockwise) {
+    updates[index]++;
+    return true;
+}
+
+// Simulates a pin-change interrupt firing for the transition
+void setAndInterrupt(pin_t pin, bool val) {
+    setPin(pin, val);
+    encoder_quadrature_isr();
+}
+
+void oneClockwise(void) {
+    setAndInterrupt(0, false);
+    setAndInterrupt(1, false);
+    setAndInterrupt(0, true);
+    setAndInterrupt(1, true);
+}
+
+// Events as read from the other half
+encoder_events_t remoteEvents(uint8_t count) {
+    encoder_events_t events;
+    memset(&events, 0, sizeof(events));
+    for (uint8_t i = 0; i < count; i++) {
+        encoder_queue_event_advanced(&events, NUM_ENCODERS_LEFT, true);
+    }
+    return events;
+}
+
+class EncoderSplitTestInterrupt : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        memset(updates, 0, sizeof(updates));
+        for (int i = 0; i < 32; i++) {
+            pinIsInputHigh[i] = 0;
+            pins[i]           = 0;
+        }
+        isMaster   = true;
+        isLeftHand = true;
+        encoder_init();
+    }
+};
+
+TEST_F(EncoderSplitTestInterrupt, RemoteEventsQueueWhileLocalQueueIsFull) {
+    for (uint8_t i = 0; i < MAX_QUEUED_ENCODER_EVENTS; i++) {
+        oneClockwise();
+    }
+    EXPECT_EQ(encoder_get_overflow_count(), 1);
+
+    encoder_events_t events = remoteEvents(MAX_QUEUED_ENCODER_EVENTS - 1);
+    EXPECT_TRUE(encoder_queue_split_events(&events));
+    EXPECT_EQ(events.head, events.tail);
+
+    EXPECT_TRUE(encoder_task());
+    EXPECT_EQ(updates[0], MAX_QUEUED_ENCODER_EVENTS - 1);
+    EXPECT_EQ(updates[NUM_ENCODERS_LEFT], MAX_QUEUED_ENCODER_EVENTS - 1);
+    EXPECT_EQ(encoder_get_overflow_count(), 1);
+}
+
+TEST_F(EncoderSplitTestInterrupt, RemoteEventsAreTakenAllOrNothing) {
+    encoder_events_t first = remoteEvents(1);
+    EXPECT_TRUE(encoder_queue_split_events(&first));
+
+    encoder_events_t rest = remoteEvents(MAX_QUEUED_ENCODER_EVENTS - 1);
+    encoder_events_t copy = rest;
+    EXPECT_FALSE(encoder_queue_split_events(&rest));
+    EXPECT_EQ(memcmp(&rest, &copy, sizeof(rest)), 0);
+
+    // Once there is room, the retry takes them all
+    encoder_task();
+    EXPECT_EQ(updates[NUM_ENCODERS_LEFT], 1);
+    EXPECT_TRUE(encoder_queue_split_events(&rest));
+    encoder_task();
+    EXPECT_EQ(updates[NUM_ENCODERS_LEFT], MAX_QUEUED_ENCODER_EVENTS);
+    EXPECT_EQ(encoder_get_overflow_count(), 0);
+}
+
+TEST_F(EncoderSplitTestInterrupt, InterruptAndRemoteEventsAtOnce) {
+    const uint32_t   steps = 20000;
+    std::atomic_bool done{false};
+
+    std::thread isr([&] {
+        for (uint32_t i = 0; i < steps; i++) {
+            oneClockwise();
+        }
+        done = true;
+    });
+
+    uint32_t sent = 0;
+    while (!done) {
+        encoder_events_t events = remoteEvents(1);
+        while (!encoder_queue_split_events(&events)) {
+            encoder_task();
+        }
+        sent++;
+        encoder_task();
+    }
+    isr.join();
+    encoder_task();
+
+    EXPECT_EQ(updates[NUM_ENCODERS_LEFT], sent);
+    EXPECT_EQ(updates[0] + encoder_get_overflow_count(), steps);
+    EXPECT_EQ(updates[1] + updates[NUM_ENCODERS_LEFT + 1], 0);
+}
+
+TEST_F(EncoderSplitTestInterrupt, DrainKeepsEventsQueuedAfterTheRead) {
+    isMaster = false;
+    oneClockwise();
+    oneClockwise();
+
+    // The master reads both events
+    encoder_events_t read;
+    encoder_retrieve_events(&read);
+    uint8_t index;
+    bool    clockwise;
+    while (encoder_dequeue_event_advanced(&read, &index, &clockwise)) {
+    }
+
+    // One more arrives before its drain request does
+    oneClockwise();
+    encoder_signal_queue_drain(read.tail, read.dequeued);
+    encoder_task();
+
+    encoder_events_t events;
+    encoder_retrieve_events(&events);
+    EXPECT_EQ(events.tail, read.tail);
+    EXPECT_EQ(events.dequeued, read.dequeued);
+    EXPECT_EQ((uint8_t)(events.enqueued - events.dequeued), 1);
+    EXPECT_TRUE(encoder_dequeue_event_advanced(&events, &index, &clockwise));
+    EXPECT_EQ(index, 0);
+
+    // A drain past what has been queued is ignored
+    encoder_retrieve_events(&events);
+    encoder_signal_queue_drain((events.tail + 2) % MAX_QUEUED_ENCODER_EVENTS, events.dequeued + 2);
+    encoder_task();
+    encoder_events_t after;
+    encoder_retrieve_events(&after);
+    EXPECT_EQ(memcmp(&events, &after, sizeof(events)), 0);
+    EXPECT_EQ(updates[0], 0);
+}
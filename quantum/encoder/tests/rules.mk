@@ -8,6 +8,16 @@ encoder_SRC := \
 	$(QUANTUM_PATH)/encoder/tests/encoder_tests.cpp \
 	$(QUANTUM_PATH)/encoder.c
 
+encoder_interrupt_DEFS := -DENCODER_TESTS -DENCODER_ENABLE -DENCODER_MOCK_SINGLE
+encoder_interrupt_CONFIG := $(QUANTUM_PATH)/encoder/tests/config_mock_interrupt.h
+
+encoder_interrupt_SRC := \
+	platforms/test/timer.c \
+	drivers/encoder/encoder_quadrature.c \
+	$(QUANTUM_PATH)/encoder/tests/mock.c \
+	$(QUANTUM_PATH)/encoder/tests/encoder_tests_interrupt.cpp \
+	$(QUANTUM_PATH)/encoder.c
+
 encoder_split_left_eq_right_DEFS := -DENCODER_TESTS -DENCODER_ENABLE -DENCODER_MOCK_SPLIT
 encoder_split_left_eq_right_INC := $(QUANTUM_PATH)/split_common
 encoder_split_left_eq_right_CONFIG := $(QUANTUM_PATH)/encoder/tests/config_mock_split_left_eq_right.h
@@ -73,3 +83,14 @@ encoder_split_role_SRC := \
 	$(QUANTUM_PATH)/encoder/tests/mock_split.c \
 	$(QUANTUM_PATH)/encoder/tests/encoder_tests_split_role.cpp \
 	$(QUANTUM_PATH)/encoder.c
+
+encoder_split_interrupt_DEFS := -DENCODER_TESTS -DENCODER_ENABLE -DENCODER_MOCK_SPLIT
+encoder_split_interrupt_INC := $(QUANTUM_PATH)/split_common
+encoder_split_interrupt_CONFIG := $(QUANTUM_PATH)/encoder/tests/config_mock_split_interrupt.h
+
+encoder_split_interrupt_SRC := \
+	platforms/test/timer.c \
+	drivers/encoder/encoder_quadrature.c \
+	$(QUANTUM_PATH)/encoder/tests/mock_split.c \
+	$(QUANTUM_PATH)/encoder/tests/encoder_tests_split_interrupt.cpp \
+	$(QUANTUM_PATH)/encoder.c
@@ -1,8 +1,10 @@
 TEST_LIST += \
 	encoder \
+	encoder_interrupt \
 	encoder_split_left_eq_right \
 	encoder_split_left_gt_right \
 	encoder_split_left_lt_right \
 	encoder_split_no_left \
 	encoder_split_no_right \
 	encoder_split_role \
+	encoder_split_interrupt \
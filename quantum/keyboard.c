@@ -110,6 +110,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef EEPROM_DRIVER
 #    include "eeprom_driver.h"
 #endif
+#if defined(WEAR_LEVELING_ENABLE) && defined(WEAR_LEVELING_INCREMENTAL_CONSOLIDATION)
+#    include "wear_leveling.h"
+#endif
 #if defined(CRC_ENABLE)
 #    include "crc.h"
 #endif
@@ -131,6 +134,12 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef LEADER_ENABLE
 #    include "leader.h"
 #endif
+#ifdef DYNAMIC_MACRO_ENABLE
+#    include "process_dynamic_macro.h"
+#endif
+#ifdef DYNAMIC_KEYMAP_ENABLE
+#    include "dynamic_keymap.h"
+#endif
 #ifdef UNICODE_COMMON_ENABLE
 #    include "unicode.h"
 #endif
@@ -205,6 +214,12 @@ void matrix_scan_perf_task(void) {
     if (TIMER_DIFF_32(timer_now, matrix_timer) >= 1000) {
 #    if defined(CONSOLE_ENABLE)
         dprintf("matrix scan frequency: %lu\n", matrix_scan_count);
+#        if defined(MATRIX_IO_DELAY_CALIBRATE)
+        uint16_t calibrated, uncalibrated;
+        if (matrix_io_delay_take_calibration(&calibrated, &uncalibrated)) {
+            dprintf("matrix unselect delays calibrated to %u us per scan, down from %u us\n", calibrated, uncalibrated);
+        }
+#        endif
 #    endif
         last_matrix_scan_count = matrix_scan_count;
         matrix_timer           = timer_now;
@@ -219,6 +234,34 @@ uint32_t get_matrix_scan_rate(void) {
 #    define matrix_scan_perf_task()
 #endif
 
+#if defined(DEBUG_MATRIX_SCAN_RATE) && defined(MATRIX_IDLE_TIMEOUT)
+static uint32_t last_matrix_wake_latency = 0;
+
+// Only this half's matrix goes idle, so a change relayed from the other half of a split says nothing about waking
+static void matrix_wake_latency_task(uint8_t row) {
+#    ifdef SPLIT_KEYBOARD
+    const uint8_t first_local_row = is_keyboard_left() ? 0 : (MATRIX_ROWS / 2);
+    if (row < first_local_row || row >= first_local_row + (MATRIX_ROWS / 2)) {
+        return;
+    }
+#    endif
+
+    uint32_t wake_time;
+    if (matrix_idle_take_wake_time(&wake_time)) {
+        last_matrix_wake_latency = timer_elapsed32(wake_time);
+#    if defined(CONSOLE_ENABLE)
+        dprintf("matrix wake to report latency: %lu ms\n", last_matrix_wake_latency);
+#    endif
+    }
+}
+
+uint32_t get_matrix_wake_latency(void) {
+    return last_matrix_wake_latency;
+}
+#else
+#    define matrix_wake_latency_task(row)
+#endif
+
 #ifdef MATRIX_HAS_GHOST
 static matrix_row_t get_real_keys(uint8_t row, matrix_row_t rowdata) {
     matrix_row_t out = 0;
@@ -488,6 +531,9 @@ void keyboard_init(void) {
 #ifdef HAPTIC_ENABLE
     haptic_init();
 #endif
+#ifdef DYNAMIC_MACRO_ENABLE
+    dynamic_macro_init();
+#endif
 
 #if defined(DEBUG_MATRIX_SCAN_RATE) && defined(CONSOLE_ENABLE)
     debug_enable = true;
@@ -539,30 +585,29 @@ static bool matrix_task(void) {
     static matrix_row_t matrix_previous[MATRIX_ROWS];
 
     matrix_scan();
-    bool matrix_changed = false;
-    for (uint8_t row = 0; row < MATRIX_ROWS && !matrix_changed; row++) {
-        matrix_changed |= matrix_previous[row] ^ matrix_get_row(row);
-    }
-
     matrix_scan_perf_task();
 
-    // Short-circuit the complete matrix processing if it is not necessary
-    if (!matrix_changed) {
-        generate_tick_event();
-        return matrix_changed;
-    }
-
-    if (debug_config.matrix) {
-        matrix_print();
-    }
-
-    const bool process_keypress = should_process_keypress();
+    // Compare and process each row in a single pass, as most scans have no changes at all
+    bool matrix_changed   = false;
+    bool process_keypress = false;
 
     for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
         const matrix_row_t current_row = matrix_get_row(row);
         const matrix_row_t row_changes = current_row ^ matrix_previous[row];
 
-        if (!row_changes || has_ghost_in_row(row, current_row)) {
+        if (!row_changes) {
+            continue;
+        }
+
+        if (!matrix_changed) {
+            matrix_changed = true;
+            if (debug_config.matrix) {
+                matrix_print();
+            }
+            process_keypress = should_process_keypress();
+        }
+
+        if (has_ghost_in_row(row, current_row)) {
             continue;
         }
 
@@ -580,6 +625,15 @@ static bool matrix_task(void) {
         }
 
         matrix_previous[row] = current_row;
+
+        // The first key change on this half after the matrix wakes from idle has now been reported
+        matrix_wake_latency_task(row);
+    }
+
+    // Without key changes, still give time based features a chance to run
+    if (!matrix_changed) {
+        generate_tick_event();
+        return matrix_changed;
     }
 
     return matrix_changed;
@@ -639,6 +693,22 @@ void quantum_task(void) {
     leader_task();
 #endif
 
+#ifdef DYNAMIC_MACRO_ENABLE
+    dynamic_macro_task();
+#endif
+
+#if defined(DYNAMIC_KEYMAP_ENABLE) && defined(DYNAMIC_KEYMAP_RAM_SHADOW)
+    dynamic_keymap_task();
+#endif
+
+#ifdef EECONFIG_WRITE_BEHIND
+    eeconfig_write_behind_task();
+#endif
+
+#if defined(WEAR_LEVELING_ENABLE) && defined(WEAR_LEVELING_INCREMENTAL_CONSOLIDATION)
+    wear_leveling_task();
+#endif
+
 #ifdef WPM_ENABLE
     decay_wpm();
 #endif
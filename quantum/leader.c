@@ -7,20 +7,81 @@
 
 #include <string.h>
 
+#if __has_include("leader_data.h")
+#    include "quantum.h"
+#    include "leader_data.h"
+#    define LEADER_TRIE_ENABLE
+#endif
+
 #ifndef LEADER_TIMEOUT
 #    define LEADER_TIMEOUT 300
 #endif
 
+#ifndef LEADER_SEQUENCE_MAX_LENGTH
+#    if defined(LEADER_DATA_MAX_LENGTH) && LEADER_DATA_MAX_LENGTH > 5
+#        define LEADER_SEQUENCE_MAX_LENGTH LEADER_DATA_MAX_LENGTH
+#    else
+#        define LEADER_SEQUENCE_MAX_LENGTH 5
+#    endif
+#endif
+
+#if LEADER_SEQUENCE_MAX_LENGTH < 5
+#    error "LEADER_SEQUENCE_MAX_LENGTH must be at least 5"
+#endif
+
 // Leader key stuff
-bool     leading              = false;
-uint16_t leader_time          = 0;
-uint16_t leader_sequence[5]   = {0, 0, 0, 0, 0};
-uint8_t  leader_sequence_size = 0;
+bool     leading                                     = false;
+uint16_t leader_time                                 = 0;
+uint16_t leader_sequence[LEADER_SEQUENCE_MAX_LENGTH] = {0};
+uint8_t  leader_sequence_size                        = 0;
 
 __attribute__((weak)) void leader_start_user(void) {}
 
 __attribute__((weak)) void leader_end_user(void) {}
 
+#ifdef LEADER_TRIE_ENABLE
+// Node layout, as written by `qmk generate-leader-data`:
+//   header word: LEADER_NODE_LEAF | number of child slots, zero or a power of two
+//   result word, only present on leaf nodes
+//   (keycode, offset) word pairs, one per slot, with each child in the slot its keycode hashes to
+#    define LEADER_NODE_LEAF 0x8000
+#    define LEADER_NODE_SLOTS_MASK 0x7FFF
+#    define LEADER_NODE_NONE 0xFFFF
+
+static uint16_t leader_node = 0;
+
+__attribute__((weak)) bool process_leader_sequence_user(uint16_t result) {
+    return true;
+}
+
+__attribute__((weak)) bool process_leader_sequence_kb(uint16_t result) {
+    if (!process_leader_sequence_user(result)) {
+        return false;
+    }
+    tap_code16(result);
+    return true;
+}
+
+/**
+ * \brief Advance the trie by one keycode.
+ *
+ * Children are stored in a hash table sized by the generator so that no two share a slot, so this is a single lookup
+ * however many sequences the table holds.
+ *
+ * \return The offset of the child node, or `LEADER_NODE_NONE` if no sequence continues with this keycode.
+ */
+static uint16_t leader_trie_step(uint16_t node, uint16_t keycode) {
+    uint16_t header = pgm_read_word(&leader_data[node]);
+    uint16_t slots  = header & LEADER_NODE_SLOTS_MASK;
+    if (slots == 0) {
+        return LEADER_NODE_NONE;
+    }
+
+    uint16_t slot = node + 1 + ((header & LEADER_NODE_LEAF) ? 1 : 0) + 2 * ((keycode ^ (keycode >> 8)) & (slots - 1));
+    return pgm_read_word(&leader_data[slot]) == keycode ? pgm_read_word(&leader_data[slot + 1]) : LEADER_NODE_NONE;
+}
+#endif // LEADER_TRIE_ENABLE
+
 void leader_start(void) {
     if (leading) {
         return;
@@ -30,10 +91,23 @@ void leader_start(void) {
     leader_time          = timer_read();
     leader_sequence_size = 0;
     memset(leader_sequence, 0, sizeof(leader_sequence));
+#ifdef LEADER_TRIE_ENABLE
+    leader_node = 0;
+#endif
 }
 
 void leader_end(void) {
     leading = false;
+#ifdef LEADER_TRIE_ENABLE
+    // A sequence that is a prefix of a longer one only fires here, once nothing else can follow
+    if (leader_sequence_size > 0 && leader_node != LEADER_NODE_NONE) {
+        uint16_t header = pgm_read_word(&leader_data[leader_node]);
+        if (header & LEADER_NODE_LEAF) {
+            process_leader_sequence_kb(pgm_read_word(&leader_data[leader_node + 1]));
+        }
+    }
+    leader_node = LEADER_NODE_NONE;
+#endif
     leader_end_user();
 }
 
@@ -52,6 +126,14 @@ bool leader_sequence_add(uint16_t keycode) {
         return false;
     }
 
+#ifdef LEADER_TRIE_ENABLE
+    // Like a full buffer, a key that continues no sequence ends the leader sequence and is then processed as usual
+    uint16_t next_node = leader_trie_step(leader_node, keycode);
+    if (next_node == LEADER_NODE_NONE) {
+        return false;
+    }
+#endif
+
 #if defined(LEADER_NO_TIMEOUT)
     if (leader_sequence_size == 0) {
         leader_reset_timer();
@@ -61,6 +143,14 @@ bool leader_sequence_add(uint16_t keycode) {
     leader_sequence[leader_sequence_size] = keycode;
     leader_sequence_size++;
 
+#ifdef LEADER_TRIE_ENABLE
+    leader_node = next_node;
+    // Resolve without waiting for the timeout as soon as no longer sequence can follow
+    if ((pgm_read_word(&leader_data[leader_node]) & LEADER_NODE_SLOTS_MASK) == 0) {
+        leader_end();
+    }
+#endif
+
     return true;
 }
 
@@ -77,7 +167,7 @@ void leader_reset_timer(void) {
 }
 
 bool leader_sequence_is(uint16_t kc1, uint16_t kc2, uint16_t kc3, uint16_t kc4, uint16_t kc5) {
-    return leader_sequence[0] == kc1 && leader_sequence[1] == kc2 && leader_sequence[2] == kc3 && leader_sequence[3] == kc4 && leader_sequence[4] == kc5;
+    return leader_sequence_size <= 5 && leader_sequence[0] == kc1 && leader_sequence[1] == kc2 && leader_sequence[2] == kc3 && leader_sequence[3] == kc4 && leader_sequence[4] == kc5;
 }
 
 bool leader_sequence_one_key(uint16_t kc) {
@@ -21,6 +21,24 @@ void leader_start_user(void);
  */
 void leader_end_user(void);
 
+/**
+ * \brief User callback, invoked when a sequence from the leader table (`leader_data.h`) is matched.
+ *
+ * \param result The result of the matched sequence.
+ *
+ * \return `true` to tap the result as a keycode, `false` if it was handled.
+ */
+bool process_leader_sequence_user(uint16_t result);
+
+/**
+ * \brief Keyboard callback, invoked when a sequence from the leader table (`leader_data.h`) is matched.
+ *
+ * \param result The result of the matched sequence.
+ *
+ * \return `true` if the result was tapped as a keycode.
+ */
+bool process_leader_sequence_kb(uint16_t result);
+
 /**
  * Begin the leader sequence, resetting the buffer and timer.
  */
@@ -45,7 +63,8 @@ bool leader_sequence_active(void);
  *
  * \param keycode The keycode to add.
  *
- * \return `true` if the keycode was added, `false` if the buffer is full.
+ * \return `true` if the keycode was added, `false` if the buffer is full or, with a sequence table, no sequence continues
+ * with this keycode.
  */
 bool leader_sequence_add(uint16_t keycode);
 
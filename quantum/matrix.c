@@ -21,6 +21,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "matrix.h"
 #include "debounce.h"
 #include "atomic_util.h"
+#include "timer.h"
+#include "wait.h"
+#include "debug.h"
 
 #ifdef SPLIT_KEYBOARD
 #    include "split_common/split_util.h"
@@ -51,6 +54,27 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    define MATRIX_INPUT_PRESSED_STATE 0
 #endif
 
+// Read the col pins of each row one GPIO port at a time, where the platform supports it
+#if !defined(DIRECT_PINS) && defined(DIODE_DIRECTION) && (DIODE_DIRECTION == COL2ROW) && defined(MATRIX_COL_PINS) && defined(gpio_read_port) && !defined(MATRIX_READ_PINS_INDIVIDUALLY)
+#    define MATRIX_READ_COL_PORTS
+#endif
+
+// Wait after unselecting each line for a delay calibrated at init, and/or until the sense pins read as released, instead of MATRIX_IO_DELAY
+#if defined(MATRIX_IO_DELAY_CALIBRATE) || defined(MATRIX_IO_DELAY_POLL)
+#    if defined(DIRECT_PINS) || !defined(MATRIX_ROW_PINS) || !defined(MATRIX_COL_PINS)
+#        error "MATRIX_IO_DELAY_CALIBRATE and MATRIX_IO_DELAY_POLL require MATRIX_ROW_PINS and MATRIX_COL_PINS"
+#    endif
+#    define MATRIX_ADAPTIVE_IO_DELAY
+#    ifndef MATRIX_IO_DELAY
+#        define MATRIX_IO_DELAY 30
+#    endif
+static void adaptive_unselect_delay(uint8_t line, bool key_pressed);
+#endif
+
+#if defined(MATRIX_IDLE_TIMEOUT) && (defined(DIRECT_PINS) || !defined(DIODE_DIRECTION) || (DIODE_DIRECTION != COL2ROW) || !defined(MATRIX_ROW_PINS) || !defined(MATRIX_COL_PINS))
+#    error "MATRIX_IDLE_TIMEOUT requires a COL2ROW matrix with MATRIX_ROW_PINS and MATRIX_COL_PINS"
+#endif
+
 #ifdef DIRECT_PINS
 static SPLIT_MUTABLE pin_t direct_pins[ROWS_PER_HAND][MATRIX_COLS] = DIRECT_PINS;
 #elif (DIODE_DIRECTION == ROW2COL) || (DIODE_DIRECTION == COL2ROW)
@@ -163,6 +187,74 @@ static void unselect_rows(void) {
     }
 }
 
+#            ifdef MATRIX_READ_COL_PORTS
+// The col pins that share a port and are the same distance from their column bit are moved into place together
+typedef struct {
+    uint8_t          port;  // index into col_ports
+    int8_t           shift; // column bit minus port bit
+    gpio_port_mask_t mask;
+} col_gather_t;
+
+static gpio_port_t  col_ports[MATRIX_COLS];
+static uint8_t      col_port_count = 0;
+static col_gather_t col_gathers[MATRIX_COLS];
+static uint8_t      col_gather_count = 0;
+
+static void init_col_gathers(void) {
+    col_port_count   = 0;
+    col_gather_count = 0;
+
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        pin_t pin = col_pins[col];
+        if (pin == NO_PIN) {
+            continue;
+        }
+
+        gpio_port_t port = gpio_get_pin_port(pin);
+        uint8_t     port_index;
+        for (port_index = 0; port_index < col_port_count && col_ports[port_index] != port; port_index++) {
+        }
+        if (port_index == col_port_count) {
+            col_ports[col_port_count++] = port;
+        }
+
+        gpio_port_mask_t mask  = gpio_get_pin_mask(pin);
+        int8_t           shift = col - __builtin_ctzl(mask);
+        uint8_t          gather_index;
+        for (gather_index = 0; gather_index < col_gather_count; gather_index++) {
+            if (col_gathers[gather_index].port == port_index && col_gathers[gather_index].shift == shift) {
+                break;
+            }
+        }
+        if (gather_index == col_gather_count) {
+            col_gathers[col_gather_count++] = (col_gather_t){.port = port_index, .shift = shift, .mask = 0};
+        }
+        col_gathers[gather_index].mask |= mask;
+    }
+}
+
+static matrix_row_t read_cols(void) {
+    gpio_port_mask_t port_state[MATRIX_COLS];
+
+    // Sample every port first, so that all columns are read as close together as possible
+    for (uint8_t i = 0; i < col_port_count; i++) {
+#                if MATRIX_INPUT_PRESSED_STATE == 0
+        port_state[i] = ~gpio_read_port(col_ports[i]);
+#                else
+        port_state[i] = gpio_read_port(col_ports[i]);
+#                endif
+    }
+
+    matrix_row_t row_value = 0;
+    for (uint8_t i = 0; i < col_gather_count; i++) {
+        const col_gather_t *gather = &col_gathers[i];
+        gpio_port_mask_t    bits   = port_state[gather->port] & gather->mask;
+        row_value |= gather->shift >= 0 ? (matrix_row_t)bits << gather->shift : (matrix_row_t)(bits >> -gather->shift);
+    }
+    return row_value;
+}
+#            endif
+
 __attribute__((weak)) void matrix_init_pins(void) {
     unselect_rows();
     for (uint8_t x = 0; x < MATRIX_COLS; x++) {
@@ -181,6 +273,9 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
     }
     matrix_output_select_delay();
 
+#            ifdef MATRIX_READ_COL_PORTS
+    current_row_value = read_cols();
+#            else
     // For each col...
     matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
     for (uint8_t col_index = 0; col_index < MATRIX_COLS; col_index++, row_shifter <<= 1) {
@@ -189,15 +284,170 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
         // Populate the matrix row with the state of the col pin
         current_row_value |= pin_state ? 0 : row_shifter;
     }
+#            endif
 
     // Unselect row
     unselect_row(current_row);
+#            ifdef MATRIX_ADAPTIVE_IO_DELAY
+    adaptive_unselect_delay(current_row, current_row_value != 0);
+#            else
     matrix_output_unselect_delay(current_row, current_row_value != 0); // wait for all Col signals to go HIGH
+#            endif
 
     // Update the matrix
     current_matrix[current_row] = current_row_value;
 }
 
+#            if defined(MATRIX_IDLE_TIMEOUT) || defined(MATRIX_IO_DELAY_POLL)
+// Reads every col pin at once, with whichever rows are currently selected
+static matrix_row_t read_all_cols(void) {
+#                ifdef MATRIX_READ_COL_PORTS
+    return read_cols();
+#                else
+    matrix_row_t cols_value  = 0;
+    matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
+    for (uint8_t col_index = 0; col_index < MATRIX_COLS; col_index++, row_shifter <<= 1) {
+        cols_value |= readMatrixPin(col_pins[col_index]) ? 0 : row_shifter;
+    }
+    return cols_value;
+#                endif
+}
+#            endif
+
+#            ifdef MATRIX_ADAPTIVE_IO_DELAY
+#                define ADAPTIVE_LINES ROWS_PER_HAND
+#                define adaptive_line_pins row_pins
+#                define adaptive_select_line select_row
+#                define adaptive_unselect_line unselect_row
+#                define adaptive_read_sense read_all_cols
+#            endif
+
+#            ifdef MATRIX_IDLE_TIMEOUT
+// Once nothing has been pressed for MATRIX_IDLE_TIMEOUT, every row is selected at once so that any key press pulls its col
+// pin to the pressed state. Scanning then stops until a col pin interrupt fires, or until a col reads as pressed when the
+// platform has no interrupts armed.
+static bool          idle_active   = false;
+static bool          idle_armed    = false;
+static volatile bool idle_woken    = false;
+static bool          idle_reported = true;
+static uint32_t      idle_quiet_timer;
+static uint32_t      idle_wake_time;
+
+void matrix_idle_wake(void) {
+    idle_woken = true;
+}
+
+#                if defined(PROTOCOL_CHIBIOS)
+#                    if PAL_USE_CALLBACKS
+#                        define MATRIX_IDLE_PAL_EVENTS
+static void matrix_idle_pal_callback(void *arg) {
+    (void)arg;
+    matrix_idle_wake();
+}
+#                    endif
+#                endif
+
+__attribute__((weak)) bool matrix_idle_arm_interrupts(void) {
+#                ifdef MATRIX_IDLE_PAL_EVENTS
+#                    if defined(MCU_STM32)
+    // EXTI lines are shared by every port's pin with the same pad number, so only one of two such col pins could raise
+    // events. Keep polling the cols rather than miss presses on the other.
+    for (uint8_t x = 0; x < MATRIX_COLS; x++) {
+        for (uint8_t y = x + 1; y < MATRIX_COLS; y++) {
+            if (col_pins[x] != NO_PIN && col_pins[y] != NO_PIN && PAL_PAD(col_pins[x]) == PAL_PAD(col_pins[y])) {
+                return false;
+            }
+        }
+    }
+#                    endif
+    for (uint8_t x = 0; x < MATRIX_COLS; x++) {
+        if (col_pins[x] != NO_PIN) {
+            palEnableLineEvent(col_pins[x], MATRIX_INPUT_PRESSED_STATE == 0 ? PAL_EVENT_MODE_FALLING_EDGE : PAL_EVENT_MODE_RISING_EDGE);
+            palSetLineCallback(col_pins[x], matrix_idle_pal_callback, NULL);
+        }
+    }
+    return true;
+#                else
+    // Other platforms can set up pin-change interrupts on the col pins in keyboard code, calling `matrix_idle_wake()` from the handler.
+    return false;
+#                endif
+}
+
+__attribute__((weak)) void matrix_idle_disarm_interrupts(void) {
+#                ifdef MATRIX_IDLE_PAL_EVENTS
+    for (uint8_t x = 0; x < MATRIX_COLS; x++) {
+        if (col_pins[x] != NO_PIN) {
+            palDisableLineEvent(col_pins[x]);
+        }
+    }
+#                endif
+}
+
+static void matrix_idle_enter(void) {
+    for (uint8_t x = 0; x < ROWS_PER_HAND; x++) {
+        select_row(x);
+    }
+    matrix_output_select_delay();
+
+    idle_woken    = false;
+    idle_reported = true;
+    idle_armed    = matrix_idle_arm_interrupts();
+    idle_active   = true;
+
+    // A key pressed before the interrupts were armed would not raise an edge, so check for one now
+    if (read_all_cols() != 0) {
+        matrix_idle_wake();
+    }
+}
+
+static bool matrix_idle_should_wake(void) {
+    if (idle_woken) {
+        return true;
+    }
+    return !idle_armed && read_all_cols() != 0;
+}
+
+static void matrix_idle_exit(void) {
+    if (idle_armed) {
+        matrix_idle_disarm_interrupts();
+    }
+    unselect_rows();
+    matrix_output_unselect_delay(0, true); // wait for all Col signals to go HIGH
+
+    idle_active      = false;
+    idle_reported    = false;
+    idle_wake_time   = timer_read32();
+    idle_quiet_timer = idle_wake_time;
+}
+
+// Restarts the quiet period whenever a key is held or still debouncing on this half, and goes idle once it runs out
+static void matrix_idle_update(const matrix_row_t local_matrix[]) {
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        if (raw_matrix[row] | local_matrix[row]) {
+            idle_quiet_timer = timer_read32();
+            return;
+        }
+    }
+
+    if (timer_elapsed32(idle_quiet_timer) >= MATRIX_IDLE_TIMEOUT) {
+        matrix_idle_enter();
+    }
+}
+
+bool matrix_is_idle(void) {
+    return idle_active;
+}
+
+bool matrix_idle_take_wake_time(uint32_t *wake_time) {
+    if (idle_reported) {
+        return false;
+    }
+    idle_reported = true;
+    *wake_time    = idle_wake_time;
+    return true;
+}
+#            endif // MATRIX_IDLE_TIMEOUT
+
 #        elif (DIODE_DIRECTION == ROW2COL)
 
 static bool select_col(uint8_t col) {
@@ -259,12 +509,105 @@ __attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[]
 
     // Unselect col
     unselect_col(current_col);
+#            ifdef MATRIX_ADAPTIVE_IO_DELAY
+    adaptive_unselect_delay(current_col, key_pressed);
+#            else
     matrix_output_unselect_delay(current_col, key_pressed); // wait for all Row signals to go HIGH
+#            endif
+}
+
+#            ifdef MATRIX_ADAPTIVE_IO_DELAY
+#                ifdef MATRIX_IO_DELAY_POLL
+// Whether any row pin reads as pressed, with whichever cols are currently selected
+static bool read_any_row(void) {
+    for (uint8_t row_index = 0; row_index < ROWS_PER_HAND; row_index++) {
+        if (readMatrixPin(row_pins[row_index]) == 0) {
+            return true;
+        }
+    }
+    return false;
 }
+#                endif
+
+#                define ADAPTIVE_LINES MATRIX_COLS
+#                define adaptive_line_pins col_pins
+#                define adaptive_select_line select_col
+#                define adaptive_unselect_line unselect_col
+#                define adaptive_read_sense read_any_row
+#            endif
 
 #        else
 #            error DIODE_DIRECTION must be one of COL2ROW or ROW2COL!
 #        endif
+
+#        ifdef MATRIX_ADAPTIVE_IO_DELAY
+#            ifdef MATRIX_IO_DELAY_CALIBRATE
+#                ifndef MATRIX_IO_DELAY_CALIBRATE_SAMPLES
+#                    define MATRIX_IO_DELAY_CALIBRATE_SAMPLES 8
+#                endif
+
+static uint16_t unselect_delays[ADAPTIVE_LINES];
+static uint16_t calibrated_total   = 0;
+static bool     calibration_report = false;
+
+// Times how long each strobed line takes to read as unselected again after being driven low, which stands in for how
+// long the sense pins take to recover through a pressed key on that line. The slowest sample is doubled for margin.
+static void calibrate_unselect_delays(void) {
+    calibrated_total = 0;
+    for (uint8_t line = 0; line < ADAPTIVE_LINES; line++) {
+        uint16_t slowest = 0;
+        for (uint8_t sample = 0; sample < MATRIX_IO_DELAY_CALIBRATE_SAMPLES; sample++) {
+            if (!adaptive_select_line(line)) {
+                break; // skip NO_PIN line
+            }
+            wait_us(MATRIX_IO_DELAY);
+            adaptive_unselect_line(line);
+
+            uint16_t elapsed = 0;
+            while (elapsed < MATRIX_IO_DELAY && gpio_read_pin(adaptive_line_pins[line]) == 0) {
+                wait_us(1);
+                elapsed++;
+            }
+            slowest = MAX(slowest, elapsed);
+        }
+        unselect_delays[line] = MIN(slowest * 2 + 1, MATRIX_IO_DELAY);
+        calibrated_total += unselect_delays[line];
+    }
+
+    // The console is not up yet during matrix_init(), so the result is printed later on
+    calibration_report = true;
+}
+
+bool matrix_io_delay_take_calibration(uint16_t *calibrated, uint16_t *uncalibrated) {
+    if (!calibration_report) {
+        return false;
+    }
+    calibration_report = false;
+    *calibrated        = calibrated_total;
+    *uncalibrated      = ADAPTIVE_LINES * MATRIX_IO_DELAY;
+    return true;
+}
+#            endif
+
+static void adaptive_unselect_delay(uint8_t line, bool key_pressed) {
+#            ifdef MATRIX_IO_DELAY_CALIBRATE
+    uint16_t delay = unselect_delays[line];
+#            else
+    uint16_t delay = MATRIX_IO_DELAY;
+#            endif
+
+#            ifdef MATRIX_IO_DELAY_POLL
+    // Only a pressed key on the line that was just unselected can hold a sense pin in the pressed state
+    if (key_pressed) {
+        for (uint16_t elapsed = 0; elapsed < delay && adaptive_read_sense(); elapsed++) {
+            wait_us(1);
+        }
+    }
+#            else
+    wait_us(delay);
+#            endif
+}
+#        endif // MATRIX_ADAPTIVE_IO_DELAY
 #    endif // defined(MATRIX_ROW_PINS) && defined(MATRIX_COL_PINS)
 #else
 #    error DIODE_DIRECTION is not defined!
@@ -302,6 +645,12 @@ void matrix_init(void) {
 
     // initialize key pins
     matrix_init_pins();
+#ifdef MATRIX_READ_COL_PORTS
+    init_col_gathers();
+#endif
+#ifdef MATRIX_IO_DELAY_CALIBRATE
+    calibrate_unselect_delays();
+#endif
 
     // initialize matrix state: all keys off
     memset(matrix, 0, sizeof(matrix));
@@ -321,28 +670,58 @@ __attribute__((weak)) bool transport_master_if_connected(matrix_row_t master_mat
 #endif
 
 uint8_t matrix_scan(void) {
-    matrix_row_t curr_matrix[MATRIX_ROWS] = {0};
+#ifdef MATRIX_IDLE_TIMEOUT
+    // Nothing is pressed or debouncing while idle, so only the other half and keyboard level scanning need servicing
+    if (idle_active) {
+        if (!matrix_idle_should_wake()) {
+#    ifdef SPLIT_KEYBOARD
+            return (uint8_t)matrix_post_scan();
+#    else
+            matrix_scan_kb();
+            return 0;
+#    endif
+        }
+        matrix_idle_exit();
+    }
+#endif
 
+    bool changed = false;
+
+    // Rows are read straight into raw_matrix; NO_PIN lines are skipped by the readers and so stay clear
 #if defined(DIRECT_PINS) || (DIODE_DIRECTION == COL2ROW)
     // Set row, read cols
     for (uint8_t current_row = 0; current_row < ROWS_PER_HAND; current_row++) {
-        matrix_read_cols_on_row(curr_matrix, current_row);
+        const matrix_row_t previous_row = raw_matrix[current_row];
+        matrix_read_cols_on_row(raw_matrix, current_row);
+        changed |= raw_matrix[current_row] != previous_row;
     }
 #elif (DIODE_DIRECTION == ROW2COL)
+    // Each col read updates one bit of every row, so the rows can only be compared once all cols are read
+    matrix_row_t previous_matrix[ROWS_PER_HAND];
+    memcpy(previous_matrix, raw_matrix, sizeof(previous_matrix));
+
     // Set col, read rows
     matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
     for (uint8_t current_col = 0; current_col < MATRIX_COLS; current_col++, row_shifter <<= 1) {
-        matrix_read_rows_on_col(curr_matrix, current_col, row_shifter);
+        matrix_read_rows_on_col(raw_matrix, current_col, row_shifter);
     }
-#endif
 
-    bool changed = memcmp(raw_matrix, curr_matrix, sizeof(curr_matrix)) != 0;
-    if (changed) memcpy(raw_matrix, curr_matrix, sizeof(curr_matrix));
+    for (uint8_t current_row = 0; current_row < ROWS_PER_HAND; current_row++) {
+        changed |= raw_matrix[current_row] != previous_matrix[current_row];
+    }
+#endif
 
 #ifdef SPLIT_KEYBOARD
-    changed = debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, changed) | matrix_post_scan();
+    changed = debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, changed);
+#    ifdef MATRIX_IDLE_TIMEOUT
+    matrix_idle_update(matrix + thisHand);
+#    endif
+    changed |= matrix_post_scan();
 #else
     changed = debounce(raw_matrix, matrix, ROWS_PER_HAND, changed);
+#    ifdef MATRIX_IDLE_TIMEOUT
+    matrix_idle_update(matrix);
+#    endif
     matrix_scan_kb();
 #endif
     return (uint8_t)changed;
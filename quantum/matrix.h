@@ -75,6 +75,23 @@ void matrix_scan_kb(void);
 void matrix_init_user(void);
 void matrix_scan_user(void);
 
+#ifdef MATRIX_IDLE_TIMEOUT
+/* whether scanning has stopped until a key edge wakes the matrix */
+bool matrix_is_idle(void);
+/* wake the matrix from idle, safe to call from an interrupt handler */
+void matrix_idle_wake(void);
+/* enable interrupts on the col pins that call matrix_idle_wake(), returning false if there are none */
+bool matrix_idle_arm_interrupts(void);
+void matrix_idle_disarm_interrupts(void);
+/* timestamp of the last wake from idle, only returned once per wake */
+bool matrix_idle_take_wake_time(uint32_t *wake_time);
+#endif
+
+#ifdef MATRIX_IO_DELAY_CALIBRATE
+/* total unselect delay per scan in microseconds, after and before calibration, only returned once */
+bool matrix_io_delay_take_calibration(uint16_t *calibrated, uint16_t *uncalibrated);
+#endif
+
 #ifdef SPLIT_KEYBOARD
 bool matrix_post_scan(void);
 void matrix_slave_scan_kb(void);
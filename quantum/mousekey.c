@@ -24,6 +24,16 @@
 #include "debug.h"
 #include "mousekey.h"
 
+static inline mouse_hv_report_t wheel_scale(mouse_hv_report_t unit, uint8_t count) {
+#ifdef WHEEL_EXTENDED_REPORT
+    const int32_t limit = INT16_MAX;
+#else
+    const int32_t limit = INT8_MAX;
+#endif
+    int32_t delta = (int32_t)unit * count;
+    return delta < -limit ? -limit : (delta > limit ? limit : delta);
+}
+
 static inline int8_t times_inv_sqrt2(int8_t x) {
     // 181/256 (0.70703125) is used as an approximation for 1/sqrt(2)
     // because it is close to the exact value which is 0.707106781
@@ -638,6 +648,25 @@ void mousekey_send(void) {
     host_mouse_send(&mouse_report);
 }
 
+/**
+ * @brief Sends a single report scrolling as far as several taps of a wheel keycode
+ *
+ * The report goes out like any other mousekey report, carrying held buttons and restarting the wheel repeat timer.
+ *
+ * @param[in] code uint8_t wheel keycode
+ * @param[in] count uint8_t number of taps
+ */
+void mousekey_wheel_send(uint8_t code, uint8_t count) {
+    mousekey_on(code);
+    if (code == QK_MOUSE_WHEEL_UP || code == QK_MOUSE_WHEEL_DOWN) {
+        mouse_report.v = wheel_scale(mouse_report.v, count);
+    } else {
+        mouse_report.h = wheel_scale(mouse_report.h, count);
+    }
+    mousekey_send();
+    mousekey_off(code);
+}
+
 void mousekey_clear(void) {
     mouse_report          = (report_mouse_t){};
     mousekey_repeat       = 0;
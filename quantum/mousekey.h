@@ -200,6 +200,7 @@ void           mousekey_on(uint8_t code);
 void           mousekey_off(uint8_t code);
 void           mousekey_clear(void);
 void           mousekey_send(void);
+void           mousekey_wheel_send(uint8_t code, uint8_t count);
 report_mouse_t mousekey_get_report(void);
 bool           should_mousekey_report_send(report_mouse_t *mouse_report);
 
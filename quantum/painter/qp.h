@@ -88,6 +88,23 @@
 #    define QUANTUM_PAINTER_SUPPORTS_NATIVE_COLORS FALSE
 #endif
 
+#ifndef QUANTUM_PAINTER_FLASH_STREAM_CACHE_SIZE
+/**
+ * @def This controls the size of the read-ahead cache used when loading images and fonts from external flash. Each
+ *      cache miss is filled with a single flash read, so larger caches mean fewer, longer transactions at the cost
+ *      of RAM.
+ */
+#    define QUANTUM_PAINTER_FLASH_STREAM_CACHE_SIZE 256
+#endif
+
+#ifndef QUANTUM_PAINTER_FLASH_ASSET_TABLE_ADDRESS
+/**
+ * @def This controls the address in external flash of the asset table written by `qmk painter-make-flash-image`,
+ *      used by \ref qp_flash_asset_find.
+ */
+#    define QUANTUM_PAINTER_FLASH_ASSET_TABLE_ADDRESS 0
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter types
 
@@ -353,6 +370,20 @@ bool qp_pixdata(painter_device_t device, const void *pixel_data, uint32_t native
  */
 painter_image_handle_t qp_load_image_mem(const void *buffer);
 
+#ifdef FLASH_ENABLE
+/**
+ * Loads an image stored in external flash.
+ *
+ * @note Images can be unloaded by calling \ref qp_close_image.
+ *
+ * @param address[in] the flash address of the image data to load
+ * @return an image handle usable with \ref qp_drawimage, \ref qp_drawimage_recolor, \ref qp_animate, and
+ *         \ref qp_animate_recolor.
+ * @return NULL if loading the image failed
+ */
+painter_image_handle_t qp_load_image_flash(uint32_t address);
+#endif // FLASH_ENABLE
+
 /**
  * Closes an image handle when no longer in use.
  *
@@ -440,6 +471,30 @@ void qp_stop_animation(deferred_token anim_token);
  */
 painter_font_handle_t qp_load_font_mem(const void *buffer);
 
+#ifdef FLASH_ENABLE
+/**
+ * Loads a font stored in external flash.
+ *
+ * @note Fonts can be unloaded by calling \ref qp_close_font.
+ *
+ * @param address[in] the flash address of the font data to load
+ * @return an image handle usable with \ref qp_textwidth, \ref qp_drawtext, and \ref qp_drawtext_recolor.
+ * @return NULL if loading the font failed
+ */
+painter_font_handle_t qp_load_font_flash(uint32_t address);
+
+/**
+ * Looks up an asset in the asset table written to external flash by `qmk painter-make-flash-image`.
+ *
+ * @param name[in] the name of the asset, i.e. the file name of the image or font without extension
+ * @param address[out] the flash address of the asset, suitable for \ref qp_load_image_flash or \ref qp_load_font_flash
+ * @param length[out] the length of the asset in bytes, may be NULL
+ * @return true if the asset was found
+ * @return false if there is no asset table, or the asset was not found
+ */
+bool qp_flash_asset_find(const char *name, uint32_t *address, uint32_t *length);
+#endif // FLASH_ENABLE
+
 /**
  * Closes a font handle when no longer in use.
  *
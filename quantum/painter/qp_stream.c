@@ -164,3 +164,172 @@ qp_file_stream_t qp_make_file_stream(FILE *f) {
     return stream;
 }
 #endif // QP_STREAM_HAS_FILE_IO
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Flash streams
+
+#ifdef QP_STREAM_HAS_FLASH
+
+#    include <string.h>
+#    include "flash.h"
+
+// Read-ahead cache shared between all flash streams. Decoding is almost entirely sequential, so each miss prefetches the
+// following bytes in a single flash transaction.
+static uint8_t  flash_cache[QUANTUM_PAINTER_FLASH_STREAM_CACHE_SIZE];
+static uint32_t flash_cache_address = 0;
+static uint32_t flash_cache_length  = 0;
+
+static inline int16_t flash_get(qp_stream_t *stream) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+    if (s->position >= s->length) {
+        s->is_eof = true;
+        return STREAM_EOF;
+    }
+
+    uint32_t address = s->address + s->position;
+    if (address < flash_cache_address || address >= flash_cache_address + flash_cache_length) {
+        uint32_t length = s->length - s->position;
+        if (length > sizeof(flash_cache)) {
+            length = sizeof(flash_cache);
+        }
+        if (flash_read_range(address, flash_cache, length) != FLASH_STATUS_SUCCESS) {
+            flash_cache_length = 0;
+            s->is_eof          = true;
+            return STREAM_EOF;
+        }
+        flash_cache_address = address;
+        flash_cache_length  = length;
+    }
+
+    s->position++;
+    return flash_cache[address - flash_cache_address];
+}
+
+static inline bool flash_put(qp_stream_t *stream, uint8_t c) {
+    // Flash streams are read-only.
+    return false;
+}
+
+static inline int flash_seek(qp_stream_t *stream, int32_t offset, int origin) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+
+    // Handle as per fseek
+    int32_t position = s->position;
+    switch (origin) {
+        case SEEK_SET:
+            position = offset;
+            break;
+        case SEEK_CUR:
+            position += offset;
+            break;
+        case SEEK_END:
+            position = s->length + offset;
+            break;
+        default:
+            return -1;
+    }
+
+    // Same bounds as memory streams, being at the end is okay
+    if (position < 0 || position > s->length) {
+        return -1;
+    }
+
+    s->position = position;
+    s->is_eof   = false;
+    return 0;
+}
+
+static inline int32_t flash_tell(qp_stream_t *stream) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+    return s->position;
+}
+
+static inline bool flash_is_eof(qp_stream_t *stream) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+    return s->is_eof;
+}
+
+static inline void flash_close(qp_stream_t *stream) {
+    // No-op.
+}
+
+qp_flash_stream_t qp_make_flash_stream(uint32_t address, int32_t length) {
+    qp_flash_stream_t stream = {
+        .base     = {.get = flash_get, .put = flash_put, .seek = flash_seek, .tell = flash_tell, .is_eof = flash_is_eof, .close = flash_close},
+        .address  = address,
+        .length   = length,
+        .position = 0,
+    };
+    return stream;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Flash asset table
+
+// The most recent successful lookup, valid until the asset table is rewritten. Assets tend to be looked up by name each
+// time they are loaded, so this saves rescanning the table.
+static qp_flash_asset_v1_t asset_cache;
+static uint32_t            asset_cache_table_end = 0;
+
+bool qp_flash_asset_find(const char *name, uint32_t *address, uint32_t *length) {
+    if (asset_cache_table_end != 0 && strncmp(asset_cache.name, name, sizeof(asset_cache.name)) == 0) {
+        if (address) {
+            *address = asset_cache.address;
+        }
+        if (length) {
+            *length = asset_cache.length;
+        }
+        return true;
+    }
+
+    qp_flash_asset_table_v1_t table;
+    if (flash_read_range(QUANTUM_PAINTER_FLASH_ASSET_TABLE_ADDRESS, &table, sizeof(table)) != FLASH_STATUS_SUCCESS) {
+        return false;
+    }
+    if (table.magic != QP_FLASH_ASSET_TABLE_MAGIC || table.version != QP_FLASH_ASSET_TABLE_VERSION) {
+        qp_dprintf("qp_flash_asset_find: fail (no asset table found)\n");
+        return false;
+    }
+
+    uint32_t entry_address = QUANTUM_PAINTER_FLASH_ASSET_TABLE_ADDRESS + sizeof(table);
+    for (uint16_t i = 0; i < table.count; ++i, entry_address += sizeof(qp_flash_asset_v1_t)) {
+        qp_flash_asset_v1_t asset;
+        if (flash_read_range(entry_address, &asset, sizeof(asset)) != FLASH_STATUS_SUCCESS) {
+            return false;
+        }
+        if (strncmp(asset.name, name, sizeof(asset.name)) == 0) {
+            asset_cache           = asset;
+            asset_cache_table_end = entry_address + sizeof(asset);
+            if (address) {
+                *address = asset.address;
+            }
+            if (length) {
+                *length = asset.length;
+            }
+            return true;
+        }
+    }
+
+    qp_dprintf("qp_flash_asset_find: fail (asset not found)\n");
+    return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Flash invalidation
+
+static inline bool flash_ranges_overlap(uint32_t a, uint32_t a_len, uint32_t b, uint32_t b_len) {
+    return a < b + b_len && b < a + a_len;
+}
+
+void flash_contents_changed(uint32_t addr, size_t len) {
+    // Anything cached from the affected range is stale once the erase or program starts. Images and fonts that are
+    // already open are not revalidated, so they should be closed before the flash underneath them is rewritten.
+    if (flash_ranges_overlap(addr, len, flash_cache_address, flash_cache_length)) {
+        flash_cache_length = 0;
+    }
+    if (asset_cache_table_end != 0 && flash_ranges_overlap(addr, len, QUANTUM_PAINTER_FLASH_ASSET_TABLE_ADDRESS, asset_cache_table_end - QUANTUM_PAINTER_FLASH_ASSET_TABLE_ADDRESS)) {
+        asset_cache_table_end = 0;
+    }
+}
+
+#endif // QP_STREAM_HAS_FLASH
@@ -23,6 +23,10 @@
 
 #include "qp_internal.h"
 
+#ifdef FLASH_ENABLE
+#    define QP_STREAM_HAS_FLASH
+#endif // FLASH_ENABLE
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Stream API
 
@@ -83,3 +87,44 @@ typedef struct qp_file_stream_t {
 qp_file_stream_t qp_make_file_stream(FILE *f);
 
 #endif // QP_STREAM_HAS_FILE_IO
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Flash streams
+
+#ifdef QP_STREAM_HAS_FLASH
+
+typedef struct qp_flash_stream_t {
+    qp_stream_t base;
+    uint32_t    address;
+    int32_t     length;
+    int32_t     position;
+    bool        is_eof;
+} qp_flash_stream_t;
+
+qp_flash_stream_t qp_make_flash_stream(uint32_t address, int32_t length);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Flash asset table
+
+#    define QP_FLASH_ASSET_TABLE_MAGIC 0x54415051 // "QPAT"
+#    define QP_FLASH_ASSET_TABLE_VERSION 0x01
+#    define QP_FLASH_ASSET_NAME_LENGTH 24
+
+typedef struct QP_PACKED qp_flash_asset_table_v1_t {
+    uint32_t magic;   // QP_FLASH_ASSET_TABLE_MAGIC
+    uint8_t  version; // QP_FLASH_ASSET_TABLE_VERSION
+    uint8_t  reserved;
+    uint16_t count; // Number of qp_flash_asset_v1_t entries following the table header
+} qp_flash_asset_table_v1_t;
+
+_Static_assert(sizeof(qp_flash_asset_table_v1_t) == 8, "qp_flash_asset_table_v1_t must be 8 bytes in v1 of the asset table");
+
+typedef struct QP_PACKED qp_flash_asset_v1_t {
+    char     name[QP_FLASH_ASSET_NAME_LENGTH]; // Null-padded, not necessarily null-terminated
+    uint32_t address;                          // Absolute address of the asset in flash
+    uint32_t length;
+} qp_flash_asset_v1_t;
+
+_Static_assert(sizeof(qp_flash_asset_v1_t) == 32, "qp_flash_asset_v1_t must be 32 bytes in v1 of the asset table");
+
+#endif // QP_STREAM_HAS_FLASH
@@ -0,0 +1,141 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <algorithm>
+#include <cstring>
+#include "gtest/gtest.h"
+#include "spi_flash_emulator.hpp"
+
+extern "C" {
+#include "flash.h"
+#include "qp_stream.h"
+}
+
+class QpFlashStream : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        SpiFlashEmulator::Instance().reset_instance();
+        flash_init();
+        // Start each test with an empty stream cache and asset cache
+        flash_contents_changed(0, EXTERNAL_FLASH_SIZE);
+    }
+
+    static std::vector<std::uint8_t> pattern(std::size_t length, std::uint8_t seed) {
+        std::vector<std::uint8_t> data(length);
+        for (std::size_t i = 0; i < length; ++i) {
+            data[i] = (std::uint8_t)(seed + i * 13);
+        }
+        return data;
+    }
+
+    static std::vector<std::uint8_t> read_all(qp_flash_stream_t &stream) {
+        std::vector<std::uint8_t> data;
+        qp_stream_setpos(&stream, 0);
+        for (int16_t c = qp_stream_get(&stream); c >= 0; c = qp_stream_get(&stream)) {
+            data.push_back((std::uint8_t)c);
+        }
+        return data;
+    }
+
+    static void write_asset_table(std::uint32_t asset_address, std::uint32_t asset_length) {
+        qp_flash_asset_table_v1_t table = {.magic = QP_FLASH_ASSET_TABLE_MAGIC, .version = QP_FLASH_ASSET_TABLE_VERSION, .reserved = 0, .count = 2};
+        qp_flash_asset_v1_t       assets[2];
+        std::memset(assets, 0, sizeof(assets));
+        std::strncpy(assets[0].name, "font", sizeof(assets[0].name));
+        assets[0].address = 0;
+        assets[0].length  = 16;
+        std::strncpy(assets[1].name, "logo", sizeof(assets[1].name));
+        assets[1].address = asset_address;
+        assets[1].length  = asset_length;
+
+        EXPECT_EQ(flash_erase_sector(QUANTUM_PAINTER_FLASH_ASSET_TABLE_ADDRESS), FLASH_STATUS_SUCCESS);
+        EXPECT_EQ(flash_write_range(QUANTUM_PAINTER_FLASH_ASSET_TABLE_ADDRESS, &table, sizeof(table)), FLASH_STATUS_SUCCESS);
+        EXPECT_EQ(flash_write_range(QUANTUM_PAINTER_FLASH_ASSET_TABLE_ADDRESS + sizeof(table), assets, sizeof(assets)), FLASH_STATUS_SUCCESS);
+    }
+};
+
+TEST_F(QpFlashStream, ReadsMatchFlashContents) {
+    auto&         emu     = SpiFlashEmulator::Instance();
+    std::uint32_t address = 3 * EXTERNAL_FLASH_PAGE_SIZE + 5;
+    auto          data    = pattern(5 * QUANTUM_PAINTER_FLASH_STREAM_CACHE_SIZE + 11, 0x42);
+    std::copy(data.begin(), data.end(), emu.storage().begin() + address);
+
+    qp_flash_stream_t stream = qp_make_flash_stream(address, data.size());
+    EXPECT_EQ(read_all(stream), data);
+    EXPECT_TRUE(qp_stream_eof(&stream));
+    EXPECT_EQ(emu.read_transactions(), (data.size() + QUANTUM_PAINTER_FLASH_STREAM_CACHE_SIZE - 1) / QUANTUM_PAINTER_FLASH_STREAM_CACHE_SIZE) << "Sequential reads should be served by one flash read per cache fill";
+}
+
+TEST_F(QpFlashStream, SeekWithinCacheDoesNotReadFlash) {
+    auto& emu  = SpiFlashEmulator::Instance();
+    auto  data = pattern(QUANTUM_PAINTER_FLASH_STREAM_CACHE_SIZE, 0x17);
+    std::copy(data.begin(), data.end(), emu.storage().begin());
+
+    qp_flash_stream_t stream = qp_make_flash_stream(0, data.size());
+    EXPECT_EQ(qp_stream_get(&stream), data[0]);
+    EXPECT_EQ(qp_stream_setpos(&stream, 20), 0);
+    EXPECT_EQ(qp_stream_get(&stream), data[20]);
+    EXPECT_EQ(qp_stream_setpos(&stream, 3), 0);
+    EXPECT_EQ(qp_stream_get(&stream), data[3]);
+    EXPECT_EQ(emu.read_transactions(), 1);
+}
+
+TEST_F(QpFlashStream, WriteInvalidatesCache) {
+    auto old_data = pattern(QUANTUM_PAINTER_FLASH_STREAM_CACHE_SIZE, 0x01);
+    auto new_data = pattern(QUANTUM_PAINTER_FLASH_STREAM_CACHE_SIZE, 0x80);
+    EXPECT_EQ(flash_write_range(0, old_data.data(), old_data.size()), FLASH_STATUS_SUCCESS);
+
+    qp_flash_stream_t stream = qp_make_flash_stream(0, old_data.size());
+    EXPECT_EQ(read_all(stream), old_data);
+
+    EXPECT_EQ(flash_erase_sector(0), FLASH_STATUS_SUCCESS);
+    EXPECT_EQ(read_all(stream), std::vector<std::uint8_t>(old_data.size(), 0xFF)) << "Erased flash should not be served from the cache";
+
+    EXPECT_EQ(flash_write_range(0, new_data.data(), new_data.size()), FLASH_STATUS_SUCCESS);
+    EXPECT_EQ(read_all(stream), new_data) << "Programmed flash should not be served from the cache";
+}
+
+TEST_F(QpFlashStream, UnrelatedWriteKeepsCache) {
+    auto& emu  = SpiFlashEmulator::Instance();
+    auto  data = pattern(QUANTUM_PAINTER_FLASH_STREAM_CACHE_SIZE, 0x33);
+    std::copy(data.begin(), data.end(), emu.storage().begin());
+
+    qp_flash_stream_t stream = qp_make_flash_stream(0, data.size());
+    EXPECT_EQ(read_all(stream), data);
+    auto reads = emu.read_transactions();
+
+    EXPECT_EQ(flash_erase_sector(EXTERNAL_FLASH_SECTOR_SIZE), FLASH_STATUS_SUCCESS);
+    EXPECT_EQ(read_all(stream), data);
+    EXPECT_EQ(emu.read_transactions(), reads);
+}
+
+TEST_F(QpFlashStream, AssetFindSeesRewrittenTable) {
+    std::uint32_t address = 0;
+    std::uint32_t length  = 0;
+    EXPECT_FALSE(qp_flash_asset_find("logo", &address, &length)) << "Erased flash has no asset table";
+
+    write_asset_table(8192, 100);
+    EXPECT_TRUE(qp_flash_asset_find("logo", &address, &length));
+    EXPECT_EQ(address, 8192);
+    EXPECT_EQ(length, 100);
+    EXPECT_FALSE(qp_flash_asset_find("missing", &address, &length));
+
+    write_asset_table(12288, 200);
+    EXPECT_TRUE(qp_flash_asset_find("logo", &address, &length));
+    EXPECT_EQ(address, 12288) << "Asset lookups should not be served from a stale table";
+    EXPECT_EQ(length, 200);
+
+    EXPECT_EQ(flash_erase_sector(QUANTUM_PAINTER_FLASH_ASSET_TABLE_ADDRESS), FLASH_STATUS_SUCCESS);
+    EXPECT_FALSE(qp_flash_asset_find("logo", &address, &length));
+}
+
+TEST_F(QpFlashStream, RepeatedAssetFindUsesCache) {
+    auto& emu = SpiFlashEmulator::Instance();
+    write_asset_table(8192, 100);
+
+    std::uint32_t address = 0;
+    EXPECT_TRUE(qp_flash_asset_find("logo", &address, NULL));
+    auto reads = emu.read_transactions();
+    EXPECT_TRUE(qp_flash_asset_find("logo", &address, NULL));
+    EXPECT_EQ(address, 8192);
+    EXPECT_EQ(emu.read_transactions(), reads);
+}
@@ -0,0 +1,24 @@
+qp_flash_stream_DEFS := \
+	-DNO_PRINT \
+	-DEEPROM_TEST_HARNESS \
+	-DFLASH_ENABLE \
+	-DQUANTUM_PAINTER_ENABLE \
+	-DQUANTUM_PAINTER_FLASH_STREAM_CACHE_SIZE=64 \
+	-DQUANTUM_PAINTER_FLASH_ASSET_TABLE_ADDRESS=1024 \
+	-DEXTERNAL_FLASH_SPI_SLAVE_SELECT_PIN=0 \
+	-DEXTERNAL_FLASH_SIZE=16384 \
+	-DEXTERNAL_FLASH_BLOCK_SIZE=4096 \
+	-DEXTERNAL_FLASH_SECTOR_SIZE=1024 \
+	-DEXTERNAL_FLASH_PAGE_SIZE=64
+
+qp_flash_stream_INC := \
+	$(QUANTUM_PATH)/painter \
+	$(TOP_DIR)/drivers/flash \
+	$(PLATFORM_PATH)/test
+
+qp_flash_stream_SRC := \
+	$(QUANTUM_PATH)/painter/tests/qp_flash_stream_tests.cpp \
+	$(QUANTUM_PATH)/painter/qp_stream.c \
+	$(TOP_DIR)/drivers/flash/flash_spi.c \
+	$(PLATFORM_PATH)/test/timer.c \
+	$(PLATFORM_PATH)/test/spi_flash_emulator.cpp
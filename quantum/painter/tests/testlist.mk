@@ -0,0 +1,2 @@
+TEST_LIST += \
+	qp_flash_stream
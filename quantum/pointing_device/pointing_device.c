@@ -243,7 +243,7 @@ report_mouse_t pointing_device_adjust_by_defines(report_mouse_t mouse_report) {
  * @brief Retrieves and processes pointing device data.
  *
  * This function is part of the keyboard loop and retrieves the mouse report from the pointing device driver.
- * It applies any optional configuration e.g. rotation or axis inversion and then initiates a send.
+ * It applies any optional configuration e.g. rotation, axis inversion or acceleration and then initiates a send.
  *
  */
 __attribute__((weak)) bool pointing_device_task(void) {
@@ -303,9 +303,18 @@ __attribute__((weak)) bool pointing_device_task(void) {
         local_mouse_report  = pointing_device_adjust_by_defines_right(local_mouse_report);
         shared_mouse_report = pointing_device_adjust_by_defines(shared_mouse_report);
     }
-    local_mouse_report = is_keyboard_left() ? pointing_device_task_combined_kb(local_mouse_report, shared_mouse_report) : pointing_device_task_combined_kb(shared_mouse_report, local_mouse_report);
+    report_mouse_t left_report  = is_keyboard_left() ? local_mouse_report : shared_mouse_report;
+    report_mouse_t right_report = is_keyboard_left() ? shared_mouse_report : local_mouse_report;
+#    ifdef POINTING_DEVICE_ACCEL_ENABLE
+    left_report  = pointing_device_accel_apply(left_report);
+    right_report = pointing_device_accel_apply_right(right_report);
+#    endif
+    local_mouse_report = pointing_device_task_combined_kb(left_report, right_report);
 #else
     local_mouse_report = pointing_device_adjust_by_defines(local_mouse_report);
+#    ifdef POINTING_DEVICE_ACCEL_ENABLE
+    local_mouse_report = pointing_device_accel_apply(local_mouse_report);
+#    endif
     local_mouse_report = pointing_device_task_kb(local_mouse_report);
 #endif
     // automatic mouse layer function
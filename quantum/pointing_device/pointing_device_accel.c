@@ -0,0 +1,260 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifdef POINTING_DEVICE_ACCEL_ENABLE
+
+#    include <string.h>
+#    include "pointing_device.h"
+#    include "pointing_device_accel.h"
+#    include "timer.h"
+#    include "util.h"
+
+#    define ACCEL_FRACTION_BITS 8
+#    define ACCEL_ONE ((int32_t)1 << ACCEL_FRACTION_BITS)
+
+/* Reciprocal of 2*pi, scaled so that tau = ACCEL_TAU_SCALE / cutoff is in 1/16 ms when cutoff is in centihertz */
+#    define ACCEL_TAU_SCALE 254648UL
+
+#    if defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)
+#        define ACCEL_STATE_COUNT 2
+#    else
+#        define ACCEL_STATE_COUNT 1
+#    endif
+
+typedef struct {
+    int32_t  x;           /* Smoothed x delta, fixed point */
+    int32_t  y;           /* Smoothed y delta, fixed point */
+    int16_t  remainder_x; /* Sub-count carry for x, fixed point */
+    int16_t  remainder_y; /* Sub-count carry for y, fixed point */
+    uint16_t speed;       /* Smoothed speed in counts per ms, fixed point (one euro only) */
+    uint16_t last_motion; /* Timer value of the last report with movement */
+    uint16_t last_sample; /* Timer value of the last processed report */
+} pointing_device_accel_state_t;
+
+static const pointing_device_accel_point_t accel_curve[] = POINTING_DEVICE_ACCEL_CURVE;
+_Static_assert(ARRAY_SIZE(accel_curve) > 0, "POINTING_DEVICE_ACCEL_CURVE must have at least one point");
+
+static pointing_device_accel_state_t accel_state[ACCEL_STATE_COUNT] = {0};
+static bool                          accel_enabled                  = true;
+
+static inline uint32_t accel_abs(int32_t value) {
+    return value < 0 ? -value : value;
+}
+
+/**
+ * @brief Approximates the length of a 2D vector without square roots
+ *
+ * Uses max + 3/8 * min, which stays within 7% of the euclidean length.
+ *
+ * @param[in] x int32_t
+ * @param[in] y int32_t
+ * @return uint32_t approximate magnitude, same scale as the input
+ */
+static uint32_t accel_magnitude(int32_t x, int32_t y) {
+    uint32_t ax = accel_abs(x);
+    uint32_t ay = accel_abs(y);
+    return MAX(ax, ay) + ((MIN(ax, ay) * 3) >> 3);
+}
+
+/**
+ * @brief Moves a fixed point value towards a target
+ *
+ * @param[in] from current value
+ * @param[in] to target value
+ * @param[in] alpha 8.8 fixed point weight of the target
+ * @return int32_t blended value
+ */
+static inline int32_t accel_blend(int32_t from, int32_t to, uint16_t alpha) {
+    // The difference of two fixed point deltas stays below 2^24 and alpha is at most 1.0, so the unsigned product fits
+    uint32_t step = accel_abs(to - from) * alpha / ACCEL_ONE;
+    return to < from ? from - (int32_t)step : from + (int32_t)step;
+}
+
+#    ifdef POINTING_DEVICE_SMOOTHING_ONE_EURO
+/**
+ * @brief Computes the low pass filter weight for a cutoff frequency and sample interval
+ *
+ * alpha = dt / (dt + tau), with tau = 1 / (2 * pi * cutoff)
+ *
+ * @param[in] cutoff uint32_t cutoff frequency in centihertz
+ * @param[in] dt uint16_t sample interval in ms
+ * @return uint16_t 8.8 fixed point weight
+ */
+static uint16_t accel_one_euro_alpha(uint32_t cutoff, uint16_t dt) {
+    uint32_t tau = ACCEL_TAU_SCALE / MAX(cutoff, 1);
+    uint32_t dt16 = (uint32_t)dt * 16;
+    return (dt16 << ACCEL_FRACTION_BITS) / (dt16 + tau);
+}
+#    endif
+
+/**
+ * @brief Looks up the acceleration gain for a given speed
+ *
+ * Linearly interpolates between the points of POINTING_DEVICE_ACCEL_CURVE, clamping to the first and last gain.
+ *
+ * @param[in] speed uint16_t speed in counts per report, 8.8 fixed point
+ * @return uint16_t 8.8 fixed point gain
+ */
+uint16_t pointing_device_accel_get_gain(uint16_t speed) {
+    if (speed <= ((uint16_t)accel_curve[0].speed << ACCEL_FRACTION_BITS)) {
+        return accel_curve[0].gain;
+    }
+    for (uint8_t i = 1; i < ARRAY_SIZE(accel_curve); i++) {
+        uint16_t upper = (uint16_t)accel_curve[i].speed << ACCEL_FRACTION_BITS;
+        if (speed < upper) {
+            uint16_t lower = (uint16_t)accel_curve[i - 1].speed << ACCEL_FRACTION_BITS;
+            int32_t  span  = (int32_t)accel_curve[i].gain - accel_curve[i - 1].gain;
+            return accel_curve[i - 1].gain + span * ((speed - lower) >> 4) / ((upper - lower) >> 4);
+        }
+    }
+    return accel_curve[ARRAY_SIZE(accel_curve) - 1].gain;
+}
+
+/**
+ * @brief Applies gain to a fixed point delta and carries the fractional part
+ *
+ * @param[in] value int32_t fixed point delta
+ * @param[in] gain uint16_t 8.8 fixed point gain
+ * @param[in,out] remainder int16_t fractional carry from the previous report
+ * @return mouse_xy_report_t whole counts to report
+ */
+static mouse_xy_report_t accel_scale_axis(int32_t value, uint16_t gain, int16_t *remainder) {
+    // Split the multiply so that extended reports cannot overflow
+    int32_t scaled = (value / ACCEL_ONE) * gain + ((value % ACCEL_ONE) * gain) / ACCEL_ONE;
+
+    // Drop the carry on direction changes so it does not fight the new direction
+    if ((scaled < 0 && *remainder > 0) || (scaled > 0 && *remainder < 0)) {
+        *remainder = 0;
+    }
+    scaled += *remainder;
+
+    int32_t whole = scaled / ACCEL_ONE;
+    whole         = CONSTRAIN_HID_XY(whole);
+    *remainder    = (whole == XY_REPORT_MIN || whole == XY_REPORT_MAX) ? 0 : scaled - whole * ACCEL_ONE;
+    return whole;
+}
+
+/**
+ * @brief Runs smoothing, acceleration and sub-count carry for one pointing device
+ *
+ * @param[in,out] state pointing_device_accel_state_t for the device
+ * @param[in] mouse_report report_mouse_t
+ * @return report_mouse_t with adjusted x and y
+ */
+static report_mouse_t accel_process(pointing_device_accel_state_t *state, report_mouse_t mouse_report) {
+    int32_t  x      = (int32_t)mouse_report.x * ACCEL_ONE;
+    int32_t  y      = (int32_t)mouse_report.y * ACCEL_ONE;
+    bool     moving = mouse_report.x || mouse_report.y;
+    uint16_t dt     = MIN(timer_elapsed(state->last_sample), POINTING_DEVICE_ACCEL_IDLE_RESET_MS);
+
+    if (moving) {
+        if (timer_elapsed(state->last_motion) > POINTING_DEVICE_ACCEL_IDLE_RESET_MS) {
+            memset(state, 0, sizeof(pointing_device_accel_state_t));
+        }
+        state->last_motion = timer_read();
+    } else if (state->x == 0 && state->y == 0) {
+        // Nothing moving and nothing left in the filter
+        return mouse_report;
+    }
+    state->last_sample = timer_read();
+    if (dt == 0) {
+        dt = 1;
+    }
+
+#    if defined(POINTING_DEVICE_SMOOTHING_EMA) || defined(POINTING_DEVICE_SMOOTHING_ONE_EURO)
+#        if defined(POINTING_DEVICE_SMOOTHING_EMA)
+    uint16_t alpha = POINTING_DEVICE_SMOOTHING_EMA_ALPHA;
+#        else
+    uint32_t raw_speed = accel_magnitude(x, y) / dt;
+    state->speed       = accel_blend(state->speed, MIN(raw_speed, UINT16_MAX), accel_one_euro_alpha(POINTING_DEVICE_ONE_EURO_D_CUTOFF, dt));
+    uint32_t cutoff    = POINTING_DEVICE_ONE_EURO_MIN_CUTOFF + (((uint32_t)POINTING_DEVICE_ONE_EURO_BETA * state->speed) >> ACCEL_FRACTION_BITS);
+    uint16_t alpha     = accel_one_euro_alpha(cutoff, dt);
+#        endif
+    state->x = accel_blend(state->x, x, alpha);
+    state->y = accel_blend(state->y, y, alpha);
+
+    // Let the tail of the filter settle to zero once the sensor stops
+    if (!moving && accel_abs(state->x) < ACCEL_ONE / 4 && accel_abs(state->y) < ACCEL_ONE / 4) {
+        state->x     = 0;
+        state->y     = 0;
+        state->speed = 0;
+        return mouse_report;
+    }
+    x = state->x;
+    y = state->y;
+#    else
+    if (!moving) {
+        return mouse_report;
+    }
+#    endif
+
+    uint16_t gain  = pointing_device_accel_get_gain(MIN(accel_magnitude(x, y), UINT16_MAX));
+    mouse_report.x = accel_scale_axis(x, gain, &state->remainder_x);
+    mouse_report.y = accel_scale_axis(y, gain, &state->remainder_y);
+    return mouse_report;
+}
+
+/**
+ * @brief Applies the configured smoothing and acceleration to a mouse report
+ *
+ * This runs after rotation and inversion and before pointing_device_task_kb. Only x and y are adjusted.
+ *
+ * @param[in] mouse_report report_mouse_t
+ * @return report_mouse_t with adjusted values
+ */
+report_mouse_t pointing_device_accel_apply(report_mouse_t mouse_report) {
+    if (!accel_enabled) {
+        return mouse_report;
+    }
+    return accel_process(&accel_state[0], mouse_report);
+}
+
+#    if defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)
+/**
+ * @brief Applies the configured smoothing and acceleration to the right side mouse report
+ *
+ * Keeps separate filter state from the left side.
+ *
+ * NOTE: Only available when using SPLIT_POINTING_ENABLE and POINTING_DEVICE_COMBINED
+ *
+ * @param[in] mouse_report report_mouse_t
+ * @return report_mouse_t with adjusted values
+ */
+report_mouse_t pointing_device_accel_apply_right(report_mouse_t mouse_report) {
+    if (!accel_enabled) {
+        return mouse_report;
+    }
+    return accel_process(&accel_state[1], mouse_report);
+}
+#    endif
+
+/**
+ * @brief Clears all filter and sub-count state
+ *
+ */
+void pointing_device_accel_reset(void) {
+    memset(accel_state, 0, sizeof(accel_state));
+}
+
+/**
+ * @brief Enables or disables acceleration and smoothing at runtime
+ *
+ * @param[in] enable bool
+ */
+void pointing_device_accel_set_enabled(bool enable) {
+    if (enable != accel_enabled) {
+        pointing_device_accel_reset();
+    }
+    accel_enabled = enable;
+}
+
+/**
+ * @brief Gets whether acceleration and smoothing are enabled
+ *
+ * @return bool
+ */
+bool pointing_device_accel_get_enabled(void) {
+    return accel_enabled;
+}
+
+#endif // POINTING_DEVICE_ACCEL_ENABLE
@@ -0,0 +1,70 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "report.h"
+
+#ifdef POINTING_DEVICE_ACCEL_ENABLE
+
+/* All gains and filter coefficients are unsigned 8.8 fixed point, 256 == 1.0 */
+#    define POINTING_DEVICE_ACCEL_GAIN(g) ((uint16_t)((g) * 256))
+
+/* Acceleration curve, as {speed, gain} points sorted by speed. Speed is in counts per report. */
+#    ifndef POINTING_DEVICE_ACCEL_CURVE
+#        define POINTING_DEVICE_ACCEL_CURVE \
+            { {0, POINTING_DEVICE_ACCEL_GAIN(1)}, {4, POINTING_DEVICE_ACCEL_GAIN(1)}, {16, POINTING_DEVICE_ACCEL_GAIN(1.5)}, {48, POINTING_DEVICE_ACCEL_GAIN(2.5)}, {96, POINTING_DEVICE_ACCEL_GAIN(3)} }
+#    endif
+/* Filter and sub-pixel state is discarded after this long without motion */
+#    ifndef POINTING_DEVICE_ACCEL_IDLE_RESET_MS
+#        define POINTING_DEVICE_ACCEL_IDLE_RESET_MS 100
+#    endif
+
+#    if defined(POINTING_DEVICE_SMOOTHING_EMA) && defined(POINTING_DEVICE_SMOOTHING_ONE_EURO)
+#        error "POINTING_DEVICE_SMOOTHING_EMA and POINTING_DEVICE_SMOOTHING_ONE_EURO are mutually exclusive"
+#    endif
+#    ifdef POINTING_DEVICE_SMOOTHING_EMA
+/* Weight of the newest sample, 8.8 fixed point in the range (0, 256] */
+#        ifndef POINTING_DEVICE_SMOOTHING_EMA_ALPHA
+#            define POINTING_DEVICE_SMOOTHING_EMA_ALPHA 128
+#        endif
+#        if POINTING_DEVICE_SMOOTHING_EMA_ALPHA < 1 || POINTING_DEVICE_SMOOTHING_EMA_ALPHA > 256
+#            error "POINTING_DEVICE_SMOOTHING_EMA_ALPHA must be between 1 and 256"
+#        endif
+#    endif
+#    ifdef POINTING_DEVICE_SMOOTHING_ONE_EURO
+/* Cutoff frequency at rest, in centihertz */
+#        ifndef POINTING_DEVICE_ONE_EURO_MIN_CUTOFF
+#            define POINTING_DEVICE_ONE_EURO_MIN_CUTOFF 1000
+#        endif
+/* Cutoff increase in centihertz per count/ms of speed */
+#        ifndef POINTING_DEVICE_ONE_EURO_BETA
+#            define POINTING_DEVICE_ONE_EURO_BETA 500
+#        endif
+/* Cutoff frequency of the speed estimate, in centihertz */
+#        ifndef POINTING_DEVICE_ONE_EURO_D_CUTOFF
+#            define POINTING_DEVICE_ONE_EURO_D_CUTOFF 500
+#        endif
+#        if POINTING_DEVICE_ONE_EURO_MIN_CUTOFF < 1 || POINTING_DEVICE_ONE_EURO_D_CUTOFF < 1
+#            error "POINTING_DEVICE_ONE_EURO_MIN_CUTOFF and POINTING_DEVICE_ONE_EURO_D_CUTOFF must be at least 1"
+#        endif
+#    endif
+
+typedef struct {
+    uint8_t  speed; /* Counts per report */
+    uint16_t gain;  /* 8.8 fixed point multiplier */
+} pointing_device_accel_point_t;
+
+report_mouse_t pointing_device_accel_apply(report_mouse_t mouse_report);
+void           pointing_device_accel_reset(void);
+void           pointing_device_accel_set_enabled(bool enable);
+bool           pointing_device_accel_get_enabled(void);
+uint16_t       pointing_device_accel_get_gain(uint16_t speed);
+
+#    if defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)
+report_mouse_t pointing_device_accel_apply_right(report_mouse_t mouse_report);
+#    endif
+
+#endif // POINTING_DEVICE_ACCEL_ENABLE
@@ -0,0 +1,8 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#define POINTING_DEVICE_ACCEL_CURVE \
+    { {0, POINTING_DEVICE_ACCEL_GAIN(0.5)} }
+#define POINTING_DEVICE_SMOOTHING_EMA
+#define POINTING_DEVICE_SMOOTHING_EMA_ALPHA 128
@@ -0,0 +1,85 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include <vector>
+
+extern "C" {
+#include "pointing_device/pointing_device_accel.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+struct step {
+    int16_t left;
+    int16_t right;
+};
+
+static report_mouse_t make_report(int16_t x) {
+    report_mouse_t report = {};
+    report.x              = x;
+    return report;
+}
+
+class PointingDeviceAccelCombined : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        set_time(0);
+        pointing_device_accel_reset();
+    }
+
+    // Runs one side on its own, one report per millisecond
+    std::vector<int16_t> run_alone(const std::vector<step> &steps, bool right) {
+        std::vector<int16_t> out;
+        set_time(0);
+        pointing_device_accel_reset();
+        for (const auto &s : steps) {
+            advance_time(1);
+            if (right) {
+                out.push_back(pointing_device_accel_apply_right(make_report(s.right)).x);
+            } else {
+                out.push_back(pointing_device_accel_apply(make_report(s.left)).x);
+            }
+        }
+        return out;
+    }
+};
+
+TEST_F(PointingDeviceAccelCombined, SidesAreFilteredSeparately) {
+    // Left state settles at 10 counts, right at 2, with a gain of 0.5
+    EXPECT_EQ(pointing_device_accel_apply(make_report(20)).x, 5);
+    EXPECT_EQ(pointing_device_accel_apply_right(make_report(4)).x, 1);
+    EXPECT_EQ(pointing_device_accel_apply(make_report(20)).x, 7);
+    EXPECT_EQ(pointing_device_accel_apply_right(make_report(4)).x, 1);
+}
+
+TEST_F(PointingDeviceAccelCombined, InterleavedMatchesEachSideAlone) {
+    // Odd sized movements leave a sub-count remainder on every report
+    std::vector<step> steps = {{1, 3}, {1, -1}, {3, 1}, {1, 1}, {-5, 1}, {1, 7}, {1, 1}, {0, 1}, {0, -3}, {2, 0}, {1, 1}, {1, 1}};
+
+    std::vector<int16_t> left  = run_alone(steps, false);
+    std::vector<int16_t> right = run_alone(steps, true);
+
+    set_time(0);
+    pointing_device_accel_reset();
+    for (size_t i = 0; i < steps.size(); i++) {
+        advance_time(1);
+        EXPECT_EQ(pointing_device_accel_apply(make_report(steps[i].left)).x, left[i]) << "left report " << i;
+        EXPECT_EQ(pointing_device_accel_apply_right(make_report(steps[i].right)).x, right[i]) << "right report " << i;
+    }
+}
+
+TEST_F(PointingDeviceAccelCombined, SlowMotionIsNotLost) {
+    // One count per report at a gain of 0.5 should move about half a count per report on each side
+    int32_t left  = 0;
+    int32_t right = 0;
+    for (int i = 0; i < 64; i++) {
+        advance_time(1);
+        left += pointing_device_accel_apply(make_report(1)).x;
+        right += pointing_device_accel_apply_right(make_report(1)).x;
+    }
+    EXPECT_EQ(left, 31);
+    EXPECT_EQ(right, 31);
+}
@@ -0,0 +1,7 @@
+pointing_device_accel_combined_DEFS := -DPOINTING_DEVICE_ACCEL_ENABLE -DSPLIT_POINTING_ENABLE -DPOINTING_DEVICE_COMBINED
+pointing_device_accel_combined_CONFIG := $(QUANTUM_PATH)/pointing_device/tests/config_combined.h
+
+pointing_device_accel_combined_SRC := \
+	platforms/test/timer.c \
+	$(QUANTUM_PATH)/pointing_device/tests/pointing_device_accel_combined_tests.cpp \
+	$(QUANTUM_PATH)/pointing_device/pointing_device_accel.c
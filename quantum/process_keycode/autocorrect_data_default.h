@@ -83,3 +83,103 @@ static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {108, 43,  0,
                                                                   116, 99,  104, 0,   10, 12, 8,   11, 0,   129, 104, 116, 0,   72,  69, 2,   10,  80, 2,   18,  89,  2,   21,  156, 2,  24,  167, 2,   0,   22,  18,  18,  11,  6,   0,   131, 115, 101, 110, 0,   12,  21,  23, 22,  0,   129, 110, 103, 0,   12,  0,   86,  98, 2,   23, 124, 2,   0,   68,  105, 2,   22,  114, 2,   0,   12, 15,  0,   131, 105, 115, 111, 110, 0,   4,   6,   6,   18,  0,   131, 105, 111, 110, 0,   76,  131, 2,   22, 146, 2,   0,  23,  12,  19,  8,   21,  0,   134, 101, 116, 105, 116, 105, 111, 110, 0,   18,  19,  0,   131, 105, 116, 105, 111, 110, 0,   23,  24,  8,   21,  0,   131, 116, 117, 114, 110, 0,   85,  174, 2,   23, 183, 2,   0,   23,  8,   21,  0,   130, 117, 114, 110, 0,  8,   21,  0,  128, 114, 110, 0,   7,   8,   24,  22,  19,  0,   131, 101, 117, 100, 111, 0,   24,  18,  18,  15,  0,   129, 107, 117, 112, 0,   72,  219, 2,  18,  3,   3,   0,   76,  229, 2,   15,  238,
                                                                   2,   17,  248, 2,   0,  11, 23,  44, 0,   130, 101, 105, 114, 0,   23, 12,  9,   0,  131, 108, 116, 101, 114, 0,   23, 22,  12,  15,  0,   130, 101, 110, 101, 114, 0,   23,  4,   21,  8,   23,  17,  12,  0,  135, 116, 101, 114, 97,  116, 111, 114, 0,   72, 30,  3,  17,  38,  3,   24,  51,  3,   0,   15,  4,   9,   0,  129, 115, 101, 0,   4,   12,  23,  17,  18,  6,   0,   131, 97,  105, 110, 115, 0,   22,  17,  8,   6,   17, 18,  6,   0,  133, 115, 101, 110, 115, 117, 115, 0,   74,  86,  3,   11,  96,  3,   15,  118, 3,   17,  129, 3,   22,  218, 3,   24,  232, 3,   0,   11,  24,  4,   6,   0,   130, 103, 104, 116, 0,   71,  103, 3,  10,  110, 3,   0,   12,  26,  0,   129, 116, 104, 0,   17, 8,   15,  0,  129, 116, 104, 0,   22,  24,  8,   21,  0,   131, 115, 117, 108, 116, 0,   68,  139, 3,   8,   150, 3,   22,  210, 3,   0,   21,  4,   19,  19, 4,   0,   130, 101, 110, 116, 0,   85,  157,
                                                                   3,   25,  200, 3,   0,  68, 164, 3,  21,  175, 3,   0,   19,  4,   0,  132, 112, 97, 114, 101, 110, 116, 0,   4,   19, 0,   68,  185, 3,   19,  193, 3,   0,   133, 112, 97,  114, 101, 110, 116, 0,   4,   0,  131, 101, 110, 116, 0,   8,   15,  8,   21,  0,  130, 97, 110, 116, 0,   18,  6,   0,   130, 110, 115, 116, 0,  12,  9,   8,   17,  4,   16,  0,   132, 105, 102, 101, 115, 116, 0,   83,  239, 3,   23,  6,   4,   0,   87, 246, 3,   24, 254, 3,   0,   17,  12,  0,   131, 112, 117, 116, 0,   18,  0,   130, 116, 112, 117, 116, 0,   19,  24,  18,  0,   131, 116, 112, 117, 116, 0,   70,  29,  4,   8,   41,  4,   11,  51,  4,   21,  69, 4,   0,   8,   24,  20,  8,   21,  9,   0,   129, 110, 99, 121, 0,   23, 9,   4,   22,  0,   130, 101, 116, 121, 0,   6,   21,  4,   21,  12,  8,   11,  0,   135, 105, 101, 114, 97,  114, 99,  104, 121, 0,   4,   5,  12,  15,  0,   130, 114, 97,  114, 121, 0};
+
+#define AUTOCORRECT_AUTOMATON_STATES 391
+#define AUTOCORRECT_CORRECTIONS_SIZE 414
+
+static const uint8_t autocorrect_automaton[AUTOCORRECT_AUTOMATON_STATES * 6] PROGMEM = {
+    0, 19, 0, 0, 1, 0, 4, 3, 0, 0, 20, 0, 5, 1, 0, 0, 23, 0, 6, 4, 0, 0, 24, 0, 7, 1, 0, 0, 28, 0, 9, 5, 0, 0, 29,
+    0, 10, 2, 0, 0, 34, 0, 11, 1, 0, 0, 36, 0, 12, 1, 0, 0, 37, 0, 15, 3, 0, 0, 38, 0, 16, 1, 0, 0, 41, 0, 17, 1, 0,
+    0, 42, 0, 18, 3, 0, 0, 43, 0, 19, 3, 0, 0, 46, 0, 21, 1, 0, 0, 49, 0, 22, 5, 0, 0, 50, 0, 23, 1, 0, 0, 55, 0,
+    24, 1, 0, 0, 56, 0, 26, 1, 0, 0, 57, 0, 44, 2, 0, 0, 58, 0, 6, 2, 3, 0, 60, 0, 19, 2, 13, 0, 62, 0, 20, 1, 0, 0,
+    64, 0, 8, 1, 0, 0, 65, 0, 4, 1, 1, 0, 66, 0, 11, 2, 7, 0, 67, 0, 12, 1, 8, 0, 69, 0, 18, 3, 12, 0, 70, 0, 8, 1,
+    0, 0, 73, 0, 4, 2, 1, 0, 74, 0, 12, 1, 8, 0, 76, 0, 15, 1, 9, 0, 77, 0, 18, 1, 12, 0, 78, 0, 21, 1, 14, 0, 79,
+    0, 4, 1, 1, 0, 80, 0, 24, 1, 17, 0, 81, 0, 8, 1, 0, 0, 82, 0, 17, 3, 11, 0, 83, 0, 8, 1, 0, 0, 86, 0, 12, 3, 8,
+    0, 87, 0, 18, 1, 12, 0, 90, 0, 4, 1, 1, 0, 91, 0, 4, 1, 1, 0, 92, 0, 6, 1, 3, 0, 93, 0, 24, 1, 17, 0, 94, 0, 25,
+    1, 0, 0, 95, 0, 18, 1, 12, 0, 96, 0, 21, 1, 14, 0, 97, 0, 22, 1, 15, 0, 98, 0, 8, 6, 0, 0, 99, 0, 4, 1, 1, 0,
+    105, 0, 8, 1, 0, 0, 106, 0, 12, 1, 8, 0, 107, 0, 23, 2, 16, 0, 108, 0, 26, 2, 18, 0, 110, 0, 11, 1, 7, 0, 112,
+    0, 7, 1, 4, 0, 113, 0, 12, 1, 8, 0, 114, 0, 10, 1, 6, 0, 115, 0, 23, 2, 16, 0, 116, 0, 6, 1, 3, 0, 118, 0, 18,
+    1, 27, 0, 119, 0, 4, 1, 1, 0, 120, 0, 19, 1, 13, 0, 121, 0, 24, 1, 17, 0, 122, 0, 6, 1, 3, 0, 123, 0, 24, 1, 17,
+    0, 124, 0, 8, 1, 36, 0, 125, 0, 18, 1, 12, 0, 126, 0, 8, 1, 0, 0, 127, 0, 15, 1, 9, 0, 128, 0, 17, 2, 11, 0,
+    129, 0, 22, 1, 15, 0, 131, 0, 21, 1, 14, 0, 132, 0, 15, 1, 9, 0, 133, 0, 22, 1, 15, 0, 134, 0, 23, 1, 16, 0,
+    135, 0, 4, 1, 1, 0, 136, 0, 26, 1, 18, 0, 137, 0, 8, 1, 49, 0, 138, 0, 24, 1, 17, 0, 139, 0, 4, 1, 1, 0, 140, 0,
+    12, 2, 8, 0, 141, 0, 6, 1, 3, 0, 143, 0, 23, 2, 16, 0, 144, 0, 25, 1, 0, 0, 146, 0, 17, 1, 11, 0, 147, 0, 4, 1,
+    1, 0, 148, 0, 5, 1, 2, 0, 149, 0, 22, 1, 15, 0, 150, 0, 18, 2, 12, 0, 151, 0, 17, 1, 11, 0, 153, 0, 16, 1, 10,
+    0, 154, 0, 6, 2, 3, 0, 155, 0, 19, 2, 13, 0, 157, 0, 8, 1, 0, 0, 159, 0, 22, 1, 15, 0, 160, 0, 12, 1, 8, 0, 161,
+    0, 24, 1, 17, 0, 162, 0, 6, 1, 3, 0, 163, 0, 9, 1, 5, 0, 164, 0, 15, 1, 9, 0, 165, 0, 19, 1, 13, 0, 166, 0, 23,
+    2, 16, 0, 167, 0, 24, 2, 17, 0, 169, 0, 9, 1, 5, 0, 171, 0, 19, 1, 13, 0, 172, 0, 17, 1, 37, 0, 173, 0, 12, 1,
+    8, 0, 174, 0, 21, 1, 14, 0, 175, 0, 12, 1, 57, 0, 176, 0, 23, 1, 16, 0, 177, 0, 21, 1, 14, 0, 178, 0, 19, 1, 13,
+    0, 179, 0, 7, 1, 4, 0, 180, 0, 24, 1, 35, 0, 181, 0, 11, 2, 55, 0, 182, 0, 24, 1, 17, 0, 184, 0, 18, 1, 27, 0,
+    185, 0, 16, 1, 10, 0, 186, 0, 21, 2, 14, 0, 187, 0, 4, 1, 1, 0, 189, 0, 12, 1, 8, 0, 190, 0, 24, 1, 17, 0, 191,
+    0, 11, 1, 7, 0, 192, 0, 12, 1, 82, 0, 193, 0, 18, 1, 12, 0, 194, 0, 15, 1, 9, 0, 195, 0, 15, 1, 9, 0, 196, 0, 6,
+    1, 3, 0, 197, 0, 23, 1, 16, 0, 198, 0, 17, 1, 11, 0, 199, 0, 25, 1, 0, 0, 200, 0, 8, 1, 38, 0, 201, 0, 15, 1, 9,
+    0, 202, 0, 15, 1, 9, 0, 203, 0, 22, 1, 15, 0, 204, 0, 4, 1, 1, 0, 205, 0, 20, 1, 0, 0, 206, 0, 21, 1, 14, 0,
+    207, 0, 21, 1, 14, 0, 208, 0, 10, 1, 6, 0, 209, 0, 21, 1, 14, 0, 210, 0, 15, 1, 9, 0, 211, 0, 8, 1, 0, 0, 212,
+    0, 19, 1, 13, 0, 213, 0, 15, 1, 9, 0, 214, 0, 10, 1, 6, 0, 215, 0, 22, 1, 15, 0, 216, 0, 4, 1, 1, 0, 217, 0, 23,
+    1, 53, 0, 218, 0, 22, 1, 15, 0, 219, 0, 24, 1, 44, 0, 220, 0, 8, 1, 0, 0, 221, 0, 8, 1, 0, 0, 222, 0, 4, 1, 24,
+    0, 223, 0, 24, 1, 17, 0, 224, 0, 23, 1, 16, 0, 225, 0, 24, 1, 17, 0, 226, 0, 21, 1, 14, 0, 227, 0, 23, 1, 53, 0,
+    228, 0, 25, 1, 0, 0, 229, 0, 8, 1, 0, 0, 230, 0, 12, 1, 26, 0, 231, 0, 8, 1, 0, 0, 232, 0, 8, 1, 38, 0, 233, 0,
+    12, 1, 8, 0, 234, 0, 21, 1, 14, 0, 235, 0, 24, 1, 17, 0, 236, 0, 22, 1, 15, 0, 237, 0, 23, 1, 16, 0, 238, 0, 23,
+    1, 16, 0, 239, 0, 8, 1, 0, 0, 240, 0, 10, 1, 6, 0, 241, 0, 21, 1, 14, 0, 242, 0, 12, 1, 8, 0, 243, 0, 23, 1, 16,
+    0, 244, 0, 12, 1, 8, 0, 245, 0, 8, 1, 49, 0, 246, 0, 4, 1, 1, 0, 247, 0, 11, 1, 7, 0, 248, 0, 4, 1, 81, 0, 249,
+    0, 8, 1, 36, 0, 250, 0, 12, 1, 8, 0, 251, 0, 21, 1, 14, 0, 252, 0, 16, 1, 10, 0, 253, 0, 16, 1, 10, 0, 254, 0,
+    8, 1, 49, 0, 255, 0, 21, 1, 14, 0, 0, 1, 21, 2, 14, 0, 1, 1, 21, 1, 14, 0, 3, 1, 4, 1, 1, 0, 4, 1, 10, 1, 6, 0,
+    5, 1, 9, 0, 5, 0, 0, 0, 22, 1, 15, 0, 6, 1, 12, 1, 39, 0, 7, 1, 8, 1, 38, 0, 8, 1, 8, 1, 0, 0, 9, 1, 12, 1, 8,
+    0, 10, 1, 23, 0, 16, 0, 5, 0, 12, 1, 8, 0, 11, 1, 22, 0, 15, 0, 10, 0, 8, 0, 38, 0, 14, 0, 8, 1, 38, 0, 12, 1,
+    8, 0, 51, 0, 19, 0, 21, 1, 14, 0, 13, 1, 24, 1, 17, 0, 14, 1, 4, 1, 1, 0, 15, 1, 4, 1, 1, 0, 16, 1, 23, 1, 16,
+    0, 17, 1, 4, 1, 1, 0, 18, 1, 24, 1, 17, 0, 19, 1, 21, 1, 14, 0, 20, 1, 24, 1, 17, 0, 21, 1, 12, 1, 39, 0, 22, 1,
+    11, 1, 7, 0, 23, 1, 12, 1, 52, 0, 24, 1, 21, 1, 14, 0, 25, 1, 17, 1, 11, 0, 26, 1, 8, 1, 51, 0, 27, 1, 19, 0,
+    94, 0, 25, 0, 9, 1, 5, 0, 28, 1, 22, 2, 15, 0, 29, 1, 22, 1, 15, 0, 31, 1, 21, 1, 14, 0, 32, 1, 24, 1, 17, 0,
+    33, 1, 23, 0, 16, 0, 30, 0, 12, 1, 8, 0, 34, 1, 12, 1, 108, 0, 35, 1, 12, 1, 8, 0, 36, 1, 7, 1, 4, 0, 37, 1, 8,
+    1, 69, 0, 38, 1, 21, 1, 14, 0, 39, 1, 25, 1, 0, 0, 40, 1, 23, 1, 16, 0, 41, 1, 24, 1, 17, 0, 42, 1, 17, 0, 11,
+    0, 36, 0, 15, 1, 9, 0, 43, 1, 21, 1, 14, 0, 44, 1, 8, 1, 0, 0, 45, 1, 21, 1, 14, 0, 46, 1, 8, 1, 0, 0, 47, 1,
+    17, 1, 11, 0, 48, 1, 10, 1, 6, 0, 49, 1, 11, 1, 55, 0, 50, 1, 6, 1, 3, 0, 51, 1, 22, 1, 15, 0, 52, 1, 23, 1, 16,
+    0, 53, 1, 23, 0, 16, 0, 40, 0, 10, 1, 6, 0, 54, 1, 44, 1, 19, 0, 55, 1, 8, 1, 0, 0, 56, 1, 8, 0, 49, 0, 44, 0,
+    18, 1, 12, 0, 57, 1, 18, 1, 12, 0, 58, 1, 17, 1, 11, 0, 59, 1, 8, 1, 49, 0, 60, 1, 4, 1, 1, 0, 61, 1, 21, 1, 14,
+    0, 62, 1, 8, 0, 49, 0, 49, 0, 22, 1, 15, 0, 63, 1, 23, 0, 16, 0, 57, 0, 8, 1, 51, 0, 64, 1, 17, 1, 37, 0, 65, 1,
+    10, 1, 6, 0, 66, 1, 17, 1, 11, 0, 67, 1, 4, 1, 1, 0, 68, 1, 8, 1, 0, 0, 69, 1, 21, 0, 14, 0, 62, 0, 7, 0, 4, 0,
+    68, 0, 8, 1, 0, 0, 70, 1, 17, 1, 11, 0, 71, 1, 23, 1, 16, 0, 72, 1, 11, 0, 55, 0, 75, 0, 21, 1, 14, 0, 73, 1, 8,
+    1, 0, 0, 74, 1, 4, 1, 1, 0, 75, 1, 23, 0, 16, 0, 79, 0, 4, 1, 87, 0, 76, 1, 23, 0, 16, 0, 84, 0, 18, 1, 12, 0,
+    77, 1, 28, 0, 0, 0, 88, 0, 8, 1, 0, 0, 78, 1, 22, 1, 15, 0, 79, 1, 12, 1, 30, 0, 80, 1, 4, 1, 50, 0, 81, 1, 19,
+    1, 13, 0, 82, 1, 22, 1, 15, 0, 83, 1, 8, 1, 49, 0, 84, 1, 23, 0, 16, 0, 94, 0, 7, 1, 4, 0, 85, 1, 18, 1, 12, 0,
+    86, 1, 15, 1, 9, 0, 87, 1, 18, 0, 12, 0, 100, 0, 25, 1, 0, 0, 88, 1, 8, 1, 49, 0, 89, 1, 8, 1, 0, 0, 90, 1, 12,
+    1, 8, 0, 91, 1, 17, 0, 11, 0, 106, 0, 23, 0, 16, 0, 111, 0, 17, 0, 11, 0, 117, 0, 28, 0, 0, 0, 123, 0, 4, 1, 1,
+    0, 92, 1, 7, 0, 4, 0, 128, 0, 10, 0, 6, 0, 134, 0, 17, 0, 11, 0, 140, 0, 6, 0, 3, 0, 144, 0, 11, 0, 25, 0, 148,
+    0, 18, 1, 12, 0, 93, 1, 8, 0, 0, 0, 154, 0, 8, 0, 0, 0, 161, 0, 23, 1, 59, 0, 94, 1, 21, 0, 14, 0, 167, 0, 7, 1,
+    4, 0, 95, 1, 7, 1, 4, 0, 96, 1, 23, 0, 16, 0, 172, 0, 17, 1, 11, 0, 97, 1, 17, 1, 11, 0, 98, 1, 8, 1, 49, 0, 99,
+    1, 8, 0, 51, 0, 180, 0, 17, 0, 11, 0, 186, 0, 10, 0, 6, 0, 191, 0, 24, 1, 35, 0, 100, 1, 22, 1, 15, 0, 101, 1,
+    17, 1, 11, 0, 102, 1, 7, 0, 4, 0, 199, 0, 6, 1, 3, 0, 103, 1, 23, 1, 16, 0, 104, 1, 8, 1, 0, 0, 105, 1, 6, 1, 3,
+    0, 106, 1, 7, 0, 4, 0, 205, 0, 23, 1, 16, 0, 107, 1, 7, 0, 4, 0, 209, 0, 17, 0, 11, 0, 215, 0, 21, 0, 14, 0,
+    221, 0, 44, 0, 19, 0, 227, 0, 22, 1, 15, 0, 108, 1, 19, 1, 21, 0, 109, 1, 6, 1, 3, 0, 110, 1, 12, 1, 52, 0, 111,
+    1, 7, 0, 4, 0, 232, 0, 8, 0, 28, 0, 237, 0, 17, 0, 11, 0, 243, 0, 8, 1, 38, 0, 112, 1, 8, 0, 0, 0, 250, 0, 7, 0,
+    4, 0, 0, 1, 17, 1, 11, 0, 113, 1, 23, 1, 16, 0, 114, 1, 23, 1, 16, 0, 115, 1, 15, 1, 9, 0, 116, 1, 11, 1, 116,
+    0, 117, 1, 4, 1, 1, 0, 118, 1, 4, 1, 1, 0, 119, 1, 23, 0, 16, 0, 5, 1, 23, 0, 16, 0, 13, 1, 17, 1, 11, 0, 120,
+    1, 8, 0, 0, 0, 18, 1, 24, 1, 17, 0, 121, 1, 22, 0, 15, 0, 24, 1, 28, 0, 0, 0, 30, 1, 8, 1, 0, 0, 122, 1, 8, 0,
+    0, 0, 35, 1, 11, 1, 25, 0, 123, 1, 18, 1, 12, 0, 124, 1, 23, 0, 53, 0, 41, 1, 6, 1, 3, 0, 125, 1, 4, 1, 24, 0,
+    126, 1, 18, 1, 12, 0, 127, 1, 7, 1, 4, 0, 128, 1, 23, 0, 16, 0, 48, 1, 12, 1, 8, 0, 129, 1, 8, 0, 0, 0, 53, 1,
+    7, 0, 4, 0, 60, 1, 8, 1, 182, 0, 130, 1, 23, 1, 16, 0, 131, 1, 23, 1, 16, 0, 132, 1, 23, 0, 16, 0, 66, 1, 22, 0,
+    15, 0, 71, 1, 8, 0, 0, 0, 79, 1, 28, 0, 0, 0, 89, 1, 21, 0, 14, 0, 99, 1, 8, 0, 0, 0, 108, 1, 8, 0, 0, 0, 114,
+    1, 17, 0, 11, 0, 119, 1, 10, 1, 6, 0, 133, 1, 18, 1, 12, 0, 134, 1, 44, 0, 250, 0, 124, 1, 8, 0, 0, 0, 126, 1,
+    8, 0, 0, 0, 134, 1, 8, 0, 0, 0, 145, 1, 17, 0, 11, 0, 149, 1
+};
+
+static const uint8_t autocorrect_corrections[AUTOCORRECT_CORRECTIONS_SIZE] PROGMEM = {
+    130, 105, 101, 102, 0, 130, 110, 115, 116, 0, 129, 115, 101, 0, 130, 108, 115, 101, 0, 131, 97, 108, 115, 101,
+    0, 129, 107, 117, 112, 0, 130, 116, 112, 117, 116, 0, 128, 114, 110, 0, 129, 116, 104, 0, 130, 114, 117, 101, 0,
+    132, 99, 113, 117, 105, 114, 101, 0, 130, 103, 104, 116, 0, 131, 108, 116, 101, 114, 0, 131, 114, 119, 97, 114,
+    100, 0, 129, 104, 116, 0, 131, 112, 117, 116, 0, 129, 116, 104, 0, 130, 114, 97, 114, 121, 0, 131, 116, 112,
+    117, 116, 0, 131, 101, 117, 100, 111, 0, 130, 117, 114, 110, 0, 131, 115, 117, 108, 116, 0, 131, 116, 117, 114,
+    110, 0, 130, 101, 116, 121, 0, 131, 103, 110, 101, 100, 0, 131, 114, 105, 110, 103, 0, 129, 110, 103, 0, 129,
+    99, 104, 0, 131, 105, 116, 99, 104, 0, 132, 112, 100, 97, 116, 101, 0, 131, 97, 117, 103, 101, 0, 130, 101, 105,
+    114, 0, 132, 112, 97, 114, 101, 110, 116, 0, 131, 97, 117, 115, 101, 0, 131, 115, 101, 110, 0, 133, 101, 105,
+    108, 105, 110, 103, 0, 131, 105, 118, 101, 100, 0, 129, 100, 101, 0, 131, 97, 108, 105, 100, 0, 131, 105, 115,
+    111, 110, 0, 130, 101, 110, 101, 114, 0, 132, 115, 101, 115, 0, 129, 114, 101, 100, 0, 130, 114, 105, 100, 101,
+    0, 131, 105, 116, 105, 111, 110, 0, 131, 101, 105, 118, 101, 0, 129, 114, 101, 100, 0, 133, 112, 97, 114, 101,
+    110, 116, 0, 130, 101, 110, 116, 0, 130, 97, 103, 117, 101, 0, 131, 97, 105, 110, 115, 0, 129, 110, 99, 121, 0,
+    130, 110, 116, 101, 101, 0, 132, 105, 102, 101, 115, 116, 0, 130, 97, 110, 116, 0, 132, 97, 114, 97, 116, 101,
+    0, 130, 104, 111, 108, 100, 0, 131, 101, 110, 116, 0, 133, 115, 101, 110, 115, 117, 115, 0, 135, 117, 97, 114,
+    97, 110, 116, 101, 101, 0, 135, 105, 101, 114, 97, 114, 99, 104, 121, 0, 135, 116, 101, 114, 97, 116, 111, 114,
+    0, 131, 112, 97, 99, 101, 0, 130, 97, 99, 101, 0, 131, 105, 111, 110, 0, 132, 0, 132, 109, 111, 100, 97, 116,
+    101, 0, 135, 99, 111, 109, 109, 111, 100, 97, 116, 101, 0, 130, 103, 101, 0, 134, 101, 116, 105, 116, 105, 111,
+    110, 0
+};
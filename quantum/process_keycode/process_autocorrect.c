@@ -22,6 +22,14 @@
 static uint8_t typo_buffer[AUTOCORRECT_MAX_LENGTH] = {KC_SPC};
 static uint8_t typo_buffer_size                    = 1;
 
+#ifdef AUTOCORRECT_AUTOMATON_STATES
+#    define AUTOCORRECT_STATE_BYTES 6
+
+// Automaton state after the first `typo_state_size` keys of the buffer
+static uint16_t typo_state      = 0;
+static uint8_t  typo_state_size = 0;
+#endif
+
 /**
  * @brief function for querying the enabled state of autocorrect
  *
@@ -189,6 +197,121 @@ __attribute__((weak)) bool apply_autocorrect(uint8_t backspaces, const char *str
     return true;
 }
 
+#ifdef AUTOCORRECT_AUTOMATON_STATES
+static inline uint8_t autocorrect_automaton_read(uint16_t state, uint8_t offset) {
+    return pgm_read_byte(autocorrect_automaton + (uint32_t)state * AUTOCORRECT_STATE_BYTES + offset);
+}
+
+static inline uint16_t autocorrect_automaton_read_link(uint16_t state, uint8_t offset) {
+    return autocorrect_automaton_read(state, offset) | autocorrect_automaton_read(state, offset + 1) << 8;
+}
+
+/**
+ * @brief Advances the automaton by one key, following failure links until a transition is found
+ *
+ * @param state current state
+ * @param keycode key appended to the buffer
+ * @return the next state
+ */
+static uint16_t autocorrect_automaton_step(uint16_t state, uint8_t keycode) {
+    for (;;) {
+        uint8_t  children = autocorrect_automaton_read(state, 1);
+        uint16_t child    = autocorrect_automaton_read_link(state, 4);
+        // Children are sorted by keycode
+        for (; children; --children, ++child) {
+            uint8_t key = autocorrect_automaton_read(child, 0);
+            if (key == keycode) {
+                return child;
+            }
+            if (key > keycode) {
+                break;
+            }
+        }
+        if (state == 0) {
+            return 0;
+        }
+        state = autocorrect_automaton_read_link(state, 2);
+    }
+}
+
+/**
+ * @brief Finds a typo ending at the last key of the buffer
+ *
+ * The automaton state is carried over from the previous key, so this costs
+ * amortized constant time. It is only recomputed from the buffer when the
+ * buffer was changed by anything other than appending, e.g. backspace.
+ *
+ * @return pointer to the PROGMEM correction data, or NULL if there is no typo
+ */
+static const uint8_t *autocorrect_find_typo(void) {
+    if (typo_state_size != typo_buffer_size - 1) {
+        typo_state = 0;
+        for (typo_state_size = 0; typo_state_size < typo_buffer_size - 1; ++typo_state_size) {
+            typo_state = autocorrect_automaton_step(typo_state, typo_buffer[typo_state_size]);
+        }
+    }
+
+    typo_state = autocorrect_automaton_step(typo_state, typo_buffer[typo_buffer_size - 1]);
+    ++typo_state_size;
+
+    // Only leaves have no children, and reaching one means a typo was found
+    if (autocorrect_automaton_read(typo_state, 1)) {
+        return NULL;
+    }
+    uint16_t offset = autocorrect_automaton_read_link(typo_state, 4);
+    if (offset >= AUTOCORRECT_CORRECTIONS_SIZE) {
+        return NULL;
+    }
+    return autocorrect_corrections + offset;
+}
+#else
+/**
+ * @brief Finds a typo ending at the last key of the buffer, by walking the buffer backwards through the trie
+ *
+ * @return pointer to the PROGMEM correction data, or NULL if there is no typo
+ */
+static const uint8_t *autocorrect_find_typo(void) {
+    // Return if buffer is smaller than the shortest word.
+    if (typo_buffer_size < AUTOCORRECT_MIN_LENGTH) {
+        return NULL;
+    }
+
+    // Check for typo in buffer using a trie stored in `autocorrect_data`.
+    uint16_t state = 0;
+    uint8_t  code  = pgm_read_byte(autocorrect_data + state);
+    for (int8_t i = typo_buffer_size - 1; i >= 0; --i) {
+        uint8_t const key_i = typo_buffer[i];
+
+        if (code & 64) { // Check for match in node with multiple children.
+            code &= 63;
+            for (; code != key_i; code = pgm_read_byte(autocorrect_data + (state += 3))) {
+                if (!code) return NULL;
+            }
+            // Follow link to child node.
+            state = (pgm_read_byte(autocorrect_data + state + 1) | pgm_read_byte(autocorrect_data + state + 2) << 8);
+            // Check for match in node with single child.
+        } else if (code != key_i) {
+            return NULL;
+        } else if (!(code = pgm_read_byte(autocorrect_data + (++state)))) {
+            ++state;
+        }
+
+        // Stop if `state` becomes an invalid index. This should not normally
+        // happen, it is a safeguard in case of a bug, data corruption, etc.
+        if (state >= DICTIONARY_SIZE) {
+            return NULL;
+        }
+
+        code = pgm_read_byte(autocorrect_data + state);
+
+        if (code & 128) { // A typo was found!
+            return autocorrect_data + state;
+        }
+    }
+    return NULL;
+}
+#endif
+
 /**
  * @brief Process handler for autocorrect feature
  *
@@ -270,107 +393,87 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
     if (typo_buffer_size >= AUTOCORRECT_MAX_LENGTH) {
         memmove(typo_buffer, typo_buffer + 1, AUTOCORRECT_MAX_LENGTH - 1);
         typo_buffer_size = AUTOCORRECT_MAX_LENGTH - 1;
+#ifdef AUTOCORRECT_AUTOMATON_STATES
+        // The state is no deeper than the longest typo less one key, so it still matches the remaining keys.
+        if (typo_state_size == AUTOCORRECT_MAX_LENGTH) {
+            typo_state_size = AUTOCORRECT_MAX_LENGTH - 1;
+        }
+#endif
     }
 
     // Append `keycode` to buffer.
     typo_buffer[typo_buffer_size++] = keycode;
-    // Return if buffer is smaller than the shortest word.
-    if (typo_buffer_size < AUTOCORRECT_MIN_LENGTH) {
+
+    const uint8_t *entry = autocorrect_find_typo();
+    if (entry == NULL) {
         return true;
     }
 
-    // Check for typo in buffer using a trie stored in `autocorrect_data`.
-    uint16_t state = 0;
-    uint8_t  code  = pgm_read_byte(autocorrect_data + state);
-    for (int8_t i = typo_buffer_size - 1; i >= 0; --i) {
-        uint8_t const key_i = typo_buffer[i];
-
-        if (code & 64) { // Check for match in node with multiple children.
-            code &= 63;
-            for (; code != key_i; code = pgm_read_byte(autocorrect_data + (state += 3))) {
-                if (!code) return true;
-            }
-            // Follow link to child node.
-            state = (pgm_read_byte(autocorrect_data + state + 1) | pgm_read_byte(autocorrect_data + state + 2) << 8);
-            // Check for match in node with single child.
-        } else if (code != key_i) {
-            return true;
-        } else if (!(code = pgm_read_byte(autocorrect_data + (++state)))) {
-            ++state;
-        }
-
-        // Stop if `state` becomes an invalid index. This should not normally
-        // happen, it is a safeguard in case of a bug, data corruption, etc.
-        if (state >= DICTIONARY_SIZE) {
-            return true;
+    // A typo was found! Apply autocorrect.
+    const uint8_t backspaces = (pgm_read_byte(entry) & 63) + !record->event.pressed;
+    const char *  changes    = (const char *)(entry + 1);
+
+    /* Gather info about the typo'd word
+     *
+     * Since buffer may contain several words, delimited by spaces, we
+     * iterate from the end to find the start and length of the typo
+     */
+    char typo[AUTOCORRECT_MAX_LENGTH + 1] = {0}; // extra char for null terminator
+
+    uint8_t typo_len   = 0;
+    uint8_t typo_start = 0;
+    bool    space_last = typo_buffer[typo_buffer_size - 1] == KC_SPC;
+    for (uint8_t i = typo_buffer_size; i > 0; --i) {
+        // stop counting after finding space (unless it is the last thing)
+        if (typo_buffer[i - 1] == KC_SPC && i != typo_buffer_size) {
+            typo_start = i;
+            break;
         }
 
-        code = pgm_read_byte(autocorrect_data + state);
-
-        if (code & 128) { // A typo was found! Apply autocorrect.
-            const uint8_t backspaces = (code & 63) + !record->event.pressed;
-            const char *  changes    = (const char *)(autocorrect_data + state + 1);
-
-            /* Gather info about the typo'd word
-             *
-             * Since buffer may contain several words, delimited by spaces, we
-             * iterate from the end to find the start and length of the typo
-             */
-            char typo[AUTOCORRECT_MAX_LENGTH + 1] = {0}; // extra char for null terminator
-
-            uint8_t typo_len   = 0;
-            uint8_t typo_start = 0;
-            bool    space_last = typo_buffer[typo_buffer_size - 1] == KC_SPC;
-            for (uint8_t i = typo_buffer_size; i > 0; --i) {
-                // stop counting after finding space (unless it is the last thing)
-                if (typo_buffer[i - 1] == KC_SPC && i != typo_buffer_size) {
-                    typo_start = i;
-                    break;
-                }
-
-                ++typo_len;
-            }
-
-            // when detecting 'typo:', reduce the length of the string by one
-            if (space_last) {
-                --typo_len;
-            }
+        ++typo_len;
+    }
 
-            // convert buffer of keycodes into a string
-            for (uint8_t i = 0; i < typo_len; ++i) {
-                typo[i] = typo_buffer[typo_start + i] - KC_A + 'a';
-            }
+    // when detecting 'typo:', reduce the length of the string by one
+    if (space_last) {
+        --typo_len;
+    }
 
-            /* Gather the corrected word
-             *
-             * A) Correction of 'typo:' -- Code takes into account
-             * an extra backspace to delete the space (which we dont copy)
-             * for this reason the offset is correct to "skip" the null terminator
-             *
-             * B) When correcting 'typo' -- Need extra offset for terminator
-             */
-            char correct[AUTOCORRECT_MAX_LENGTH + 10] = {0}; // let's hope this is big enough
-
-            uint8_t offset = space_last ? backspaces : backspaces + 1;
-            strcpy(correct, typo);
-            strcpy_P(correct + typo_len - offset, changes);
-
-            if (apply_autocorrect(backspaces, changes, typo, correct)) {
-                for (uint8_t i = 0; i < backspaces; ++i) {
-                    tap_code(KC_BSPC);
-                }
-                send_string_P(changes);
-            }
+    // convert buffer of keycodes into a string
+    for (uint8_t i = 0; i < typo_len; ++i) {
+        typo[i] = typo_buffer[typo_start + i] - KC_A + 'a';
+    }
 
-            if (keycode == KC_SPC) {
-                typo_buffer[0]   = KC_SPC;
-                typo_buffer_size = 1;
-                return true;
-            } else {
-                typo_buffer_size = 0;
-                return false;
-            }
+    /* Gather the corrected word
+     *
+     * A) Correction of 'typo:' -- Code takes into account
+     * an extra backspace to delete the space (which we dont copy)
+     * for this reason the offset is correct to "skip" the null terminator
+     *
+     * B) When correcting 'typo' -- Need extra offset for terminator
+     */
+    char correct[AUTOCORRECT_MAX_LENGTH + 10] = {0}; // let's hope this is big enough
+
+    uint8_t offset = space_last ? backspaces : backspaces + 1;
+    strcpy(correct, typo);
+    strcpy_P(correct + typo_len - offset, changes);
+
+    if (apply_autocorrect(backspaces, changes, typo, correct)) {
+        for (uint8_t i = 0; i < backspaces; ++i) {
+            tap_code(KC_BSPC);
         }
+        send_string_P(changes);
+    }
+
+#ifdef AUTOCORRECT_AUTOMATON_STATES
+    // Restart the automaton from the reset buffer on the next key.
+    typo_state_size = UINT8_MAX;
+#endif
+    if (keycode == KC_SPC) {
+        typo_buffer[0]   = KC_SPC;
+        typo_buffer_size = 1;
+        return true;
+    } else {
+        typo_buffer_size = 0;
+        return false;
     }
-    return true;
 }
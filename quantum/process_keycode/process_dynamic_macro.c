@@ -18,10 +18,19 @@
 /* Author: Wojciech Siewierski < wojciech dot siewierski at onet dot pl > */
 #include "process_dynamic_macro.h"
 #include <stddef.h>
+#include <string.h>
 #include "action_layer.h"
 #include "keycodes.h"
 #include "debug.h"
+#include "timer.h"
 #include "wait.h"
+#include "matrix.h"
+#include "util.h"
+
+#ifdef DYNAMIC_MACRO_EEPROM_STORAGE
+#    include "eeprom.h"
+#    include "eeconfig.h"
+#endif
 
 #ifdef BACKLIGHT_ENABLE
 #    include "backlight.h"
@@ -82,164 +91,483 @@ __attribute__((weak)) bool dynamic_macro_valid_key_user(uint16_t keycode, keyrec
     return true;
 }
 
-/* Convenience macros used for retrieving the debug info. All of them
- * need a `direction` variable accessible at the call site.
+/* Macro events are packed into a byte stream rather than stored as
+ * whole keyrecord_t structs:
+ *
+ *   varint  (key index << 1) | pressed
+ *   [extended fields, only when key index == DYNAMIC_MACRO_EXTENDED_INDEX]
+ *   varint  milliseconds since the previous event
+ *
+ * Plain matrix key events use key index row * MATRIX_COLS + col. Anything
+ * else (encoders, combos, tap state, stored keycodes) uses the extended
+ * form:
+ *
+ *   uint8_t type | DYNAMIC_MACRO_EXTENDED_KEYCODE
+ *   uint8_t row
+ *   uint8_t col
+ *   uint8_t tap state            (unless NO_ACTION_TAPPING)
+ *   uint16_t keycode, LSB first  (only with DYNAMIC_MACRO_EXTENDED_KEYCODE)
+ *
+ * Varints use 7 bits per byte, least significant group first, with the
+ * top bit set on all but the last byte. A typical key event therefore
+ * takes 2-4 bytes.
+ */
+#define DYNAMIC_MACRO_EXTENDED_INDEX ((uint16_t)MATRIX_ROWS * MATRIX_COLS)
+#define DYNAMIC_MACRO_EXTENDED_KEYCODE 0x80
+#define DYNAMIC_MACRO_MAX_EVENT_BYTES 16
+
+#ifndef NO_ACTION_TAPPING
+_Static_assert(sizeof(tap_t) == 1, "tap_t is expected to pack into a single byte");
+#endif
+
+/* Both macros use the same buffer but read/write on different
+ * ends of it.
+ *
+ * Macro1 is written left-to-right starting from the beginning of
+ * the buffer.
+ *
+ * Macro2 is written right-to-left starting from the end of the
+ * buffer, so reading it from the end downwards gives the same byte
+ * stream as macro1.
+ *
+ * macro_buffer[0]    macro_length[0]
+ *  v                   v
+ * +------------------------------------------------------------+
+ * |>>>>>> MACRO1 >>>>>>      <<<<<<<<<<<<< MACRO2 <<<<<<<<<<<<<|
+ * +------------------------------------------------------------+
+ *                           ^                                 ^
+ *                       macro_length[1]     macro_buffer[DYNAMIC_MACRO_BUFFER_SIZE - 1]
+ *
+ * During the recording when one macro encounters the end of the
+ * other macro, the recording is stopped. Apart from this, there
+ * are no arbitrary limits for the macros' length in relation to
+ * each other: for example one can either have two medium sized
+ * macros or one long macro and one short macro. Or even one empty
+ * and one using the whole buffer.
+ */
+static uint8_t macro_buffer[DYNAMIC_MACRO_BUFFER_SIZE];
+
+_Static_assert(DYNAMIC_MACRO_BUFFER_SIZE <= UINT16_MAX, "DYNAMIC_MACRO_BUFFER_SIZE must fit the 16-bit macro lengths");
+
+/* Number of bytes used by each macro. */
+static uint16_t macro_length[2] = {0, 0};
+
+/* 0   - no macro is being recorded right now
+ * 1,2 - either macro 1 or 2 is being recorded */
+static uint8_t macro_id = 0;
+
+/* Timestamp of the previously recorded event, used for the time deltas. */
+static uint16_t macro_record_time = 0;
+
+typedef struct {
+    uint16_t      offset;            // Next byte to decode
+    uint16_t      next_event;        // Timer value at which the next event is due
+    layer_state_t saved_layer_state; // Layer state to restore after playback
+    uint8_t       slot;              // 0 or 1
+} dynamic_macro_player_t;
+
+/* Macros currently being played back. A macro can start the other
+ * macro, which then plays to completion before the outer one resumes,
+ * so the stack never holds more than two entries. */
+static dynamic_macro_player_t macro_players[2];
+static uint8_t                macro_player_depth = 0;
+
+#ifdef DYNAMIC_MACRO_RECORDED_TIMING
+static bool macro_recorded_timing = true;
+#else
+static bool macro_recorded_timing = false;
+#endif
+
+/* Convenience macros used for retrieving the debug info. */
+#define DYNAMIC_MACRO_CURRENT_SLOT(SLOT) ((SLOT) + 1)
+#define DYNAMIC_MACRO_CAPACITY(SLOT) (DYNAMIC_MACRO_BUFFER_SIZE - macro_length[!(SLOT)])
+
+/**
+ * Map a macro byte offset to its position in the shared buffer.
+ *
+ * @param[in] slot   Either 0 or 1.
+ * @param[in] offset Byte offset from the start of the macro.
+ */
+static inline uint8_t *dynamic_macro_byte(uint8_t slot, uint16_t offset) {
+    return slot == 0 ? &macro_buffer[offset] : &macro_buffer[DYNAMIC_MACRO_BUFFER_SIZE - 1 - offset];
+}
+
+static uint8_t dynamic_macro_put_varint(uint8_t *out, uint16_t value) {
+    uint8_t n = 0;
+    while (value >= 0x80) {
+        out[n++] = (value & 0x7F) | 0x80;
+        value >>= 7;
+    }
+    out[n++] = value;
+    return n;
+}
+
+static uint16_t dynamic_macro_get_varint(uint8_t slot, uint16_t *offset) {
+    uint16_t value = 0;
+    uint8_t  shift = 0;
+    uint8_t  byte;
+    do {
+        byte = *dynamic_macro_byte(slot, (*offset)++);
+        value |= (uint16_t)(byte & 0x7F) << shift;
+        shift += 7;
+    } while ((byte & 0x80) && shift < 16);
+    return value;
+}
+
+/**
+ * Pack a key record into its stream form.
+ *
+ * @param[out] out    At least DYNAMIC_MACRO_MAX_EVENT_BYTES long.
+ * @param[in]  record The key event being recorded.
+ * @param[in]  delta  Milliseconds since the previous recorded event.
+ * @return The number of bytes written.
+ */
+static uint8_t dynamic_macro_encode(uint8_t *out, keyrecord_t *record, uint16_t delta) {
+    keyevent_t *event   = &record->event;
+    uint16_t    index   = DYNAMIC_MACRO_EXTENDED_INDEX;
+    uint16_t    keycode = 0;
+    uint8_t     tap     = 0;
+    uint8_t     n;
+
+#if defined(COMBO_ENABLE) || defined(REPEAT_KEY_ENABLE)
+    keycode = record->keycode;
+#endif
+#ifndef NO_ACTION_TAPPING
+    memcpy(&tap, &record->tap, sizeof(tap));
+#endif
+
+    if (IS_KEYEVENT(*event) && event->key.row < MATRIX_ROWS && event->key.col < MATRIX_COLS && keycode == 0 && tap == 0) {
+        index = (uint16_t)event->key.row * MATRIX_COLS + event->key.col;
+    }
+
+    n = dynamic_macro_put_varint(out, (index << 1) | event->pressed);
+    if (index == DYNAMIC_MACRO_EXTENDED_INDEX) {
+        out[n++] = event->type | (keycode ? DYNAMIC_MACRO_EXTENDED_KEYCODE : 0);
+        out[n++] = event->key.row;
+        out[n++] = event->key.col;
+#ifndef NO_ACTION_TAPPING
+        out[n++] = tap;
+#endif
+        if (keycode) {
+            out[n++] = keycode & 0xFF;
+            out[n++] = keycode >> 8;
+        }
+    }
+    n += dynamic_macro_put_varint(&out[n], delta);
+    return n;
+}
+
+/**
+ * Unpack the next key record from a macro.
+ *
+ * @param[in]     slot   Either 0 or 1.
+ * @param[in,out] offset Position in the macro, advanced past the event.
+ * @param[out]    record The decoded key event, time is left at 0.
+ * @return Milliseconds between the previous event and this one.
+ */
+static uint16_t dynamic_macro_decode(uint8_t slot, uint16_t *offset, keyrecord_t *record) {
+    uint16_t head  = dynamic_macro_get_varint(slot, offset);
+    uint16_t index = head >> 1;
+
+    memset(record, 0, sizeof(keyrecord_t));
+    record->event.pressed = head & 1;
+    if (index == DYNAMIC_MACRO_EXTENDED_INDEX) {
+        uint8_t type       = *dynamic_macro_byte(slot, (*offset)++);
+        record->event.type = type & ~DYNAMIC_MACRO_EXTENDED_KEYCODE;
+        record->event.key  = (keypos_t){.row = *dynamic_macro_byte(slot, *offset), .col = *dynamic_macro_byte(slot, *offset + 1)};
+        *offset += 2;
+#ifndef NO_ACTION_TAPPING
+        memcpy(&record->tap, dynamic_macro_byte(slot, (*offset)++), sizeof(tap_t));
+#endif
+        if (type & DYNAMIC_MACRO_EXTENDED_KEYCODE) {
+            uint16_t keycode = *dynamic_macro_byte(slot, *offset) | (*dynamic_macro_byte(slot, *offset + 1) << 8);
+            *offset += 2;
+#if defined(COMBO_ENABLE) || defined(REPEAT_KEY_ENABLE)
+            record->keycode = keycode;
+#else
+            (void)keycode;
+#endif
+        }
+    } else {
+        record->event.type = KEY_EVENT;
+        record->event.key  = (keypos_t){.row = index / MATRIX_COLS, .col = index % MATRIX_COLS};
+    }
+    return dynamic_macro_get_varint(slot, offset);
+}
+
+#ifdef DYNAMIC_MACRO_EEPROM_STORAGE
+typedef struct PACKED {
+    uint16_t magic;
+    uint16_t size;
+    uint16_t length[2];
+} dynamic_macro_eeprom_header_t;
+
+#    define DYNAMIC_MACRO_EEPROM_HEADER ((void *)(DYNAMIC_MACRO_EEPROM_ADDR))
+#    define DYNAMIC_MACRO_EEPROM_DATA ((uint8_t *)(DYNAMIC_MACRO_EEPROM_ADDR) + sizeof(dynamic_macro_eeprom_header_t))
+
+_Static_assert((DYNAMIC_MACRO_EEPROM_ADDR) + sizeof(dynamic_macro_eeprom_header_t) + (DYNAMIC_MACRO_BUFFER_SIZE) <= (TOTAL_EEPROM_BYTE_COUNT), "Dynamic macros are configured to use more EEPROM than is available.");
+
+/**
+ * Write one macro and the header to EEPROM. The on-disk layout mirrors
+ * the RAM buffer so only the bytes of the changed macro are touched.
+ */
+static void dynamic_macro_save(uint8_t slot) {
+    dynamic_macro_eeprom_header_t header = {
+        .magic  = DYNAMIC_MACRO_EEPROM_MAGIC,
+        .size   = DYNAMIC_MACRO_BUFFER_SIZE,
+        .length = {macro_length[0], macro_length[1]},
+    };
+    uint16_t start = slot == 0 ? 0 : DYNAMIC_MACRO_BUFFER_SIZE - macro_length[1];
+
+    eeprom_update_block(&macro_buffer[start], DYNAMIC_MACRO_EEPROM_DATA + start, macro_length[slot]);
+    eeprom_update_block(&header, DYNAMIC_MACRO_EEPROM_HEADER, sizeof(header));
+}
+
+/**
+ * Restore both macros from EEPROM, if a valid copy is present.
+ */
+static void dynamic_macro_load(void) {
+    dynamic_macro_eeprom_header_t header;
+    eeprom_read_block(&header, DYNAMIC_MACRO_EEPROM_HEADER, sizeof(header));
+
+    if (header.magic != DYNAMIC_MACRO_EEPROM_MAGIC || header.size != DYNAMIC_MACRO_BUFFER_SIZE || (uint32_t)header.length[0] + header.length[1] > DYNAMIC_MACRO_BUFFER_SIZE) {
+        dprintln("dynamic macro: no stored macros");
+        return;
+    }
+
+    macro_length[0] = header.length[0];
+    macro_length[1] = header.length[1];
+    eeprom_read_block(macro_buffer, DYNAMIC_MACRO_EEPROM_DATA, macro_length[0]);
+    eeprom_read_block(&macro_buffer[DYNAMIC_MACRO_BUFFER_SIZE - macro_length[1]], DYNAMIC_MACRO_EEPROM_DATA + DYNAMIC_MACRO_BUFFER_SIZE - macro_length[1], macro_length[1]);
+    dprintf("dynamic macro: loaded, lengths: %u, %u\n", macro_length[0], macro_length[1]);
+}
+#endif
+
+/**
+ * Initialise the dynamic macros, restoring them from EEPROM when
+ * persistent storage is enabled.
  */
-#define DYNAMIC_MACRO_CURRENT_SLOT() (direction > 0 ? 1 : 2)
-#define DYNAMIC_MACRO_CURRENT_LENGTH(BEGIN, POINTER) ((int)(direction * ((POINTER) - (BEGIN))))
-#define DYNAMIC_MACRO_CURRENT_CAPACITY(BEGIN, END2) ((int)(direction * ((END2) - (BEGIN)) + 1))
+void dynamic_macro_init(void) {
+    macro_length[0] = 0;
+    macro_length[1] = 0;
+#ifdef DYNAMIC_MACRO_EEPROM_STORAGE
+    dynamic_macro_load();
+#endif
+}
 
 /**
  * Start recording of the dynamic macro.
  *
- * @param[out] macro_pointer The new macro buffer iterator.
- * @param[in]  macro_buffer  The macro buffer used to initialize macro_pointer.
+ * @param[in] slot Either 0 or 1.
  */
-void dynamic_macro_record_start(keyrecord_t **macro_pointer, keyrecord_t *macro_buffer, int8_t direction) {
+static void dynamic_macro_record_start(uint8_t slot) {
+    int8_t direction = slot == 0 ? +1 : -1;
+
     dprintln("dynamic macro recording: started");
 
     dynamic_macro_record_start_kb(direction);
 
     clear_keyboard();
     layer_clear();
-    *macro_pointer = macro_buffer;
+    macro_length[slot] = 0;
+    macro_id           = slot + 1;
 }
 
 /**
- * Play the dynamic macro.
+ * Queue playback of the dynamic macro. Events are sent from
+ * dynamic_macro_task() so the keyboard stays responsive.
  *
- * @param macro_buffer[in] The beginning of the macro buffer being played.
- * @param macro_end[in]    The element after the last macro buffer element.
- * @param direction[in]    Either +1 or -1, which way to iterate the buffer.
+ * @param[in] slot Either 0 or 1.
  */
-void dynamic_macro_play(keyrecord_t *macro_buffer, keyrecord_t *macro_end, int8_t direction) {
-    dprintf("dynamic macro: slot %d playback\n", DYNAMIC_MACRO_CURRENT_SLOT());
+static void dynamic_macro_play(uint8_t slot) {
+    for (uint8_t i = 0; i < macro_player_depth; i++) {
+        if (macro_players[i].slot == slot) {
+            dprintf("dynamic macro: slot %d is already playing\n", DYNAMIC_MACRO_CURRENT_SLOT(slot));
+            return;
+        }
+    }
+
+    dprintf("dynamic macro: slot %d playback\n", DYNAMIC_MACRO_CURRENT_SLOT(slot));
 
-    layer_state_t saved_layer_state = layer_state;
+    macro_players[macro_player_depth++] = (dynamic_macro_player_t){
+        .offset            = 0,
+        .next_event        = timer_read(),
+        .saved_layer_state = layer_state,
+        .slot              = slot,
+    };
 
     clear_keyboard();
     layer_clear();
+}
 
-    while (macro_buffer != macro_end) {
-        process_record(macro_buffer);
-        macro_buffer += direction;
-#ifdef DYNAMIC_MACRO_DELAY
-        wait_ms(DYNAMIC_MACRO_DELAY);
-#endif
-    }
+/**
+ * Finish playback of the innermost playing macro.
+ */
+static void dynamic_macro_play_end(void) {
+    dynamic_macro_player_t *player = &macro_players[--macro_player_depth];
 
     clear_keyboard();
 
-    layer_state_set(saved_layer_state);
+    layer_state_set(player->saved_layer_state);
+
+    dynamic_macro_play_kb(player->slot == 0 ? +1 : -1);
+}
 
-    dynamic_macro_play_kb(direction);
+/**
+ * Stop any playback in progress.
+ */
+void dynamic_macro_stop_playback(void) {
+    while (macro_player_depth > 0) {
+        dynamic_macro_play_end();
+    }
+}
+
+/**
+ * Check whether a dynamic macro is currently being played back.
+ */
+bool dynamic_macro_is_playing(void) {
+    return macro_player_depth > 0;
+}
+
+/**
+ * Choose whether playback follows the recorded timing, or replays as
+ * fast as possible (spaced by DYNAMIC_MACRO_DELAY, when defined).
+ */
+void dynamic_macro_set_recorded_timing(bool enable) {
+    macro_recorded_timing = enable;
+}
+
+bool dynamic_macro_get_recorded_timing(void) {
+    return macro_recorded_timing;
+}
+
+/**
+ * Check whether a decoded event is for a key that is physically held
+ * right now. Replaying it would press or release the key underneath
+ * the user.
+ */
+static bool dynamic_macro_key_is_held(keyrecord_t *record) {
+    return record->event.type == KEY_EVENT && record->event.key.row < MATRIX_ROWS && record->event.key.col < MATRIX_COLS && matrix_is_on(record->event.key.row, record->event.key.col);
+}
+
+/**
+ * Send the next due event of the playing macro, if any. Events for
+ * physically held keys are deferred until the key is released.
+ */
+void dynamic_macro_task(void) {
+    if (macro_player_depth == 0) {
+        return;
+    }
+
+    dynamic_macro_player_t *player = &macro_players[macro_player_depth - 1];
+    if (player->offset >= macro_length[player->slot]) {
+        dynamic_macro_play_end();
+        return;
+    }
+
+    uint16_t    offset = player->offset;
+    keyrecord_t record;
+    uint16_t    delta = dynamic_macro_decode(player->slot, &offset, &record);
+    uint16_t    due   = player->next_event;
+
+    if (macro_recorded_timing) {
+        due += delta;
+    }
+    if (!timer_expired(timer_read(), due)) {
+        return;
+    }
+    if (dynamic_macro_key_is_held(&record)) {
+        // Keep the recorded spacing to the following events once the key is released
+        player->next_event = timer_read() - (macro_recorded_timing ? delta : 0);
+        return;
+    }
+
+    player->offset    = offset;
+    record.event.time = timer_read() | 1;
+#ifdef DYNAMIC_MACRO_DELAY
+    player->next_event = macro_recorded_timing ? due : timer_read() + DYNAMIC_MACRO_DELAY;
+#else
+    player->next_event = macro_recorded_timing ? due : timer_read();
+#endif
+    // May start the other macro, which pushes a new player
+    process_record(&record);
 }
 
 /**
  * Record a single key in a dynamic macro.
  *
- * @param macro_buffer[in] The start of the used macro buffer.
- * @param macro_pointer[in,out] The current buffer position.
- * @param macro2_end[in] The end of the other macro.
- * @param direction[in]  Either +1 or -1, which way to iterate the buffer.
- * @param record[in]     The current keypress.
+ * @param slot[in]   Either 0 or 1.
+ * @param record[in] The current keypress.
  */
-void dynamic_macro_record_key(keyrecord_t *macro_buffer, keyrecord_t **macro_pointer, keyrecord_t *macro2_end, int8_t direction, keyrecord_t *record) {
+static void dynamic_macro_record_key(uint8_t slot, keyrecord_t *record) {
+    int8_t direction = slot == 0 ? +1 : -1;
+
     /* If we've just started recording, ignore all the key releases. */
-    if (!record->event.pressed && *macro_pointer == macro_buffer) {
+    if (!record->event.pressed && macro_length[slot] == 0) {
         dprintln("dynamic macro: ignoring a leading key-up event");
         return;
     }
 
+    uint8_t  packed[DYNAMIC_MACRO_MAX_EVENT_BYTES];
+    uint16_t delta = macro_length[slot] == 0 ? 0 : TIMER_DIFF_16(record->event.time, macro_record_time);
+    uint8_t  size  = dynamic_macro_encode(packed, record, delta);
+
     /* The other end of the other macro is the last buffer element it
      * is safe to use before overwriting the other macro.
      */
-    if (*macro_pointer - direction != macro2_end) {
-        **macro_pointer = *record;
-        *macro_pointer += direction;
+    if (macro_length[slot] + size <= DYNAMIC_MACRO_CAPACITY(slot)) {
+        for (uint8_t i = 0; i < size; i++) {
+            *dynamic_macro_byte(slot, macro_length[slot] + i) = packed[i];
+        }
+        macro_length[slot] += size;
+        macro_record_time = record->event.time;
     }
     dynamic_macro_record_key_kb(direction, record);
 
-    dprintf("dynamic macro: slot %d length: %d/%d\n", DYNAMIC_MACRO_CURRENT_SLOT(), DYNAMIC_MACRO_CURRENT_LENGTH(macro_buffer, *macro_pointer), DYNAMIC_MACRO_CURRENT_CAPACITY(macro_buffer, macro2_end));
+    dprintf("dynamic macro: slot %d length: %d/%d\n", DYNAMIC_MACRO_CURRENT_SLOT(slot), macro_length[slot], DYNAMIC_MACRO_CAPACITY(slot));
 }
 
 /**
  * End recording of the dynamic macro. Essentially just update the
- * pointer to the end of the macro.
+ * length of the macro.
  */
-void dynamic_macro_record_end(keyrecord_t *macro_buffer, keyrecord_t *macro_pointer, int8_t direction, keyrecord_t **macro_end) {
+static void dynamic_macro_record_end(uint8_t slot) {
+    int8_t direction = slot == 0 ? +1 : -1;
+
     dynamic_macro_record_end_kb(direction);
 
     /* Do not save the keys being held when stopping the recording,
-     * i.e. the keys used to access the layer DM_RSTP is on.
+     * i.e. the keys used to access the layer DM_RSTP is on. Events
+     * can only be decoded forwards, so find the end of the last
+     * release.
      */
-    while (macro_pointer != macro_buffer && (macro_pointer - direction)->event.pressed) {
-        dprintln("dynamic macro: trimming a trailing key-down event");
-        macro_pointer -= direction;
+    uint16_t offset = 0;
+    uint16_t end    = 0;
+    while (offset < macro_length[slot]) {
+        keyrecord_t record;
+        dynamic_macro_decode(slot, &offset, &record);
+        if (!record.event.pressed) {
+            end = offset;
+        }
+    }
+    if (end != macro_length[slot]) {
+        dprintln("dynamic macro: trimming trailing key-down events");
+        macro_length[slot] = end;
     }
 
-    dprintf("dynamic macro: slot %d saved, length: %d\n", DYNAMIC_MACRO_CURRENT_SLOT(), DYNAMIC_MACRO_CURRENT_LENGTH(macro_buffer, macro_pointer));
+    dprintf("dynamic macro: slot %d saved, length: %d\n", DYNAMIC_MACRO_CURRENT_SLOT(slot), macro_length[slot]);
 
-    *macro_end = macro_pointer;
+#ifdef DYNAMIC_MACRO_EEPROM_STORAGE
+    dynamic_macro_save(slot);
+#endif
 }
 
-/* Both macros use the same buffer but read/write on different
- * ends of it.
- *
- * Macro1 is written left-to-right starting from the beginning of
- * the buffer.
- *
- * Macro2 is written right-to-left starting from the end of the
- * buffer.
- *
- * &macro_buffer   macro_end
- *  v                   v
- * +------------------------------------------------------------+
- * |>>>>>> MACRO1 >>>>>>      <<<<<<<<<<<<< MACRO2 <<<<<<<<<<<<<|
- * +------------------------------------------------------------+
- *                           ^                                 ^
- *                         r_macro_end                  r_macro_buffer
- *
- * During the recording when one macro encounters the end of the
- * other macro, the recording is stopped. Apart from this, there
- * are no arbitrary limits for the macros' length in relation to
- * each other: for example one can either have two medium sized
- * macros or one long macro and one short macro. Or even one empty
- * and one using the whole buffer.
- */
-static keyrecord_t macro_buffer[DYNAMIC_MACRO_SIZE];
-
-/* Pointer to the first buffer element after the first macro.
- * Initially points to the very beginning of the buffer since the
- * macro is empty. */
-static keyrecord_t *macro_end = macro_buffer;
-
-/* The other end of the macro buffer. Serves as the beginning of
- * the second macro. */
-static keyrecord_t *const r_macro_buffer = macro_buffer + DYNAMIC_MACRO_SIZE - 1;
-
-/* Like macro_end but for the second macro. */
-static keyrecord_t *r_macro_end = macro_buffer + DYNAMIC_MACRO_SIZE - 1;
-
-/* A persistent pointer to the current macro position (iterator)
- * used during the recording. */
-static keyrecord_t *macro_pointer = NULL;
-
-/* 0   - no macro is being recorded right now
- * 1,2 - either macro 1 or 2 is being recorded */
-static uint8_t macro_id = 0;
-
 /**
  * If a dynamic macro is currently being recorded, stop recording.
  */
 void dynamic_macro_stop_recording(void) {
-    switch (macro_id) {
-        case 1:
-            dynamic_macro_record_end(macro_buffer, macro_pointer, +1, &macro_end);
-            break;
-        case 2:
-            dynamic_macro_record_end(r_macro_buffer, macro_pointer, -1, &r_macro_end);
-            break;
+    if (macro_id != 0) {
+        dynamic_macro_record_end(macro_id - 1);
     }
     macro_id = 0;
 }
@@ -252,18 +580,18 @@ bool process_dynamic_macro(uint16_t keycode, keyrecord_t *record) {
         if (!record->event.pressed) {
             switch (keycode) {
                 case QK_DYNAMIC_MACRO_RECORD_START_1:
-                    dynamic_macro_record_start(&macro_pointer, macro_buffer, +1);
-                    macro_id = 1;
+                    dynamic_macro_stop_playback();
+                    dynamic_macro_record_start(0);
                     return false;
                 case QK_DYNAMIC_MACRO_RECORD_START_2:
-                    dynamic_macro_record_start(&macro_pointer, r_macro_buffer, -1);
-                    macro_id = 2;
+                    dynamic_macro_stop_playback();
+                    dynamic_macro_record_start(1);
                     return false;
                 case QK_DYNAMIC_MACRO_PLAY_1:
-                    dynamic_macro_play(macro_buffer, macro_end, +1);
+                    dynamic_macro_play(0);
                     return false;
                 case QK_DYNAMIC_MACRO_PLAY_2:
-                    dynamic_macro_play(r_macro_buffer, r_macro_end, -1);
+                    dynamic_macro_play(1);
                     return false;
             }
         }
@@ -289,14 +617,7 @@ bool process_dynamic_macro(uint16_t keycode, keyrecord_t *record) {
             default:
                 if (dynamic_macro_valid_key_kb(keycode, record)) {
                     /* Store the key in the macro buffer and process it normally. */
-                    switch (macro_id) {
-                        case 1:
-                            dynamic_macro_record_key(macro_buffer, &macro_pointer, r_macro_end, +1, record);
-                            break;
-                        case 2:
-                            dynamic_macro_record_key(r_macro_buffer, &macro_pointer, macro_end, -1, record);
-                            break;
-                    }
+                    dynamic_macro_record_key(macro_id - 1, record);
                 }
                 return true;
                 break;
@@ -22,10 +22,13 @@
 #include <stdbool.h>
 #include "action.h"
 
-/* May be overridden with a custom value. Be aware that the effective
- * macro length is half of this value: each keypress is recorded twice
- * because of the down-event and up-event. This is not a bug, it's the
- * intended behavior.
+/* May be overridden with a custom value. The buffer holds roughly
+ * this many key events in the worst case: each keypress is recorded
+ * twice because of the down-event and up-event. This is not a bug,
+ * it's the intended behavior.
+ *
+ * Events are stored packed, so typical macros fit several times more
+ * events than this into the same amount of RAM.
  *
  * Usually it should be fine to set the macro size to at least 256 but
  * there have been reports of it being too much in some users' cases,
@@ -35,7 +38,27 @@
 #    define DYNAMIC_MACRO_SIZE 128
 #endif
 
+/* Size in bytes of the buffer shared by both macros. Defaults to the
+ * memory DYNAMIC_MACRO_SIZE unpacked key records would occupy.
+ */
+#ifndef DYNAMIC_MACRO_BUFFER_SIZE
+#    define DYNAMIC_MACRO_BUFFER_SIZE (DYNAMIC_MACRO_SIZE * sizeof(keyrecord_t))
+#endif
+
+#ifdef DYNAMIC_MACRO_EEPROM_STORAGE
+#    ifndef DYNAMIC_MACRO_EEPROM_ADDR
+#        if defined(VIA_ENABLE) || defined(DYNAMIC_KEYMAP_ENABLE)
+#            error "DYNAMIC_MACRO_EEPROM_ADDR must be defined when using VIA or dynamic keymaps, as they occupy the rest of the EEPROM"
+#        endif
+#        define DYNAMIC_MACRO_EEPROM_ADDR (EECONFIG_SIZE)
+#    endif
+/* Change when the packed format changes, so stale data is discarded */
+#    define DYNAMIC_MACRO_EEPROM_MAGIC (uint16_t)(0xD700 ^ ((MATRIX_ROWS) << 8) ^ (MATRIX_COLS))
+#endif
+
 void dynamic_macro_led_blink(void);
+void dynamic_macro_init(void);
+void dynamic_macro_task(void);
 bool process_dynamic_macro(uint16_t keycode, keyrecord_t *record);
 bool dynamic_macro_record_start_kb(int8_t direction);
 bool dynamic_macro_record_start_user(int8_t direction);
@@ -48,3 +71,7 @@ bool dynamic_macro_record_end_user(int8_t direction);
 bool dynamic_macro_valid_key_kb(uint16_t keycode, keyrecord_t *record);
 bool dynamic_macro_valid_key_user(uint16_t keycode, keyrecord_t *record);
 void dynamic_macro_stop_recording(void);
+void dynamic_macro_stop_playback(void);
+bool dynamic_macro_is_playing(void);
+void dynamic_macro_set_recorded_timing(bool enable);
+bool dynamic_macro_get_recorded_timing(void);
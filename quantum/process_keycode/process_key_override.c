@@ -29,6 +29,11 @@
 #    define KEY_OVERRIDE_REPEAT_DELAY 500
 #endif
 
+// Number of key overrides that can be indexed by trigger keycode. Lookups fall back to scanning every override if there are more.
+#ifndef KEY_OVERRIDE_INDEX_SIZE
+#    define KEY_OVERRIDE_INDEX_SIZE 64
+#endif
+
 // For benchmarking the time it takes to call process_key_override on every key press (needs keyboard debugging enabled as well)
 // #define BENCH_KEY_OVERRIDE
 
@@ -84,6 +89,24 @@ static uint16_t deferred_register = 0;
 // TODO: in future maybe save in EEPROM?
 static bool enabled = true;
 
+#if KEY_OVERRIDE_INDEX_SIZE > 255
+typedef uint16_t key_override_index_t;
+#else
+typedef uint8_t key_override_index_t;
+#endif
+
+// Positions of the key overrides, sorted by trigger keycode and then by position. Overrides without a trigger (KC_NO) come first.
+static key_override_index_t index_by_trigger[KEY_OVERRIDE_INDEX_SIZE];
+// Number of key overrides before the end of the array
+static uint16_t index_size = 0;
+// Value of key_override_count() the index was built for
+static uint16_t index_count = UINT16_MAX;
+// Union of the layers and trigger mods of all key overrides, to quickly reject events that no override can react to
+static layer_state_t index_layers = 0;
+static uint8_t       index_mods   = 0;
+// Whether any key override requires no mods
+static bool index_modless = false;
+
 // Forward decls
 static const key_override_t *clear_active_override(const bool allow_reregister);
 
@@ -243,13 +266,15 @@ static bool check_activation_event(const key_override_t *override, const bool ke
     }
 }
 
-/** Iterates through the list of key overrides and tries activating each, until it finds one that activates or reaches the end of overrides. Returns true if the key action for `keycode` should be sent */
-static bool try_activating_override(const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *activated) {
-    if (key_override_count() == 0) {
-        return true;
-    }
+/** Builds the index of key overrides by trigger keycode, along with the layer and mod prefilters. */
+static void build_index(void) {
+    index_count   = key_override_count();
+    index_size    = 0;
+    index_layers  = 0;
+    index_mods    = 0;
+    index_modless = false;
 
-    for (uint8_t i = 0; i < key_override_count(); i++) {
+    for (uint16_t i = 0; i < index_count; i++) {
         const key_override_t *const override = key_override_get(i);
 
         // End of array
@@ -257,138 +282,212 @@ static bool try_activating_override(const uint16_t keycode, const uint8_t layer,
             break;
         }
 
-        // Fast, but not full mods check. Most key presses will not have any mods down, and most overrides will require mods. Hence here we filter overrides that require mods to be down while no mods are down
-        if (active_mods == 0 && override->trigger_mods != 0) {
-            key_override_printf("Not activating override: Modifiers don't match\n");
-            continue;
-        }
+        index_layers |= override->layers;
+        index_mods |= override->trigger_mods;
+        index_modless |= override->trigger_mods == 0;
 
-        // Check layer
-        if ((override->layers & (1 << layer)) == 0) {
-            key_override_printf("Not activating override: Not set to activate on pressed layer\n");
-            continue;
+        // Insertion sort, stable so that overrides with the same trigger keep their order
+        if (i < KEY_OVERRIDE_INDEX_SIZE) {
+            uint16_t j = i;
+            for (; j > 0 && key_override_get(index_by_trigger[j - 1])->trigger > override->trigger; j--) {
+                index_by_trigger[j] = index_by_trigger[j - 1];
+            }
+            index_by_trigger[j] = i;
         }
+        index_size++;
+    }
 
-        // Check allowed activation events
-        if (!check_activation_event(override, key_down, is_mod)) {
-            key_override_printf("Not activating override: Activation event not allowed\n");
-            continue;
-        }
+    key_override_printf("Indexed %u key overrides\n", index_size);
+}
+
+/** Checks everything but the trigger key that is required for the override to activate on this event. */
+static bool can_activate_override(const key_override_t *override, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods) {
+    // Fast, but not full mods check. Most key presses will not have any mods down, and most overrides will require mods. Hence here we filter overrides that require mods to be down while no mods are down
+    if (active_mods == 0 && override->trigger_mods != 0) {
+        key_override_printf("Not activating override: Modifiers don't match\n");
+        return false;
+    }
 
-        const bool is_trigger = override->trigger == keycode;
+    // Check layer
+    if ((override->layers & (1 << layer)) == 0) {
+        key_override_printf("Not activating override: Not set to activate on pressed layer\n");
+        return false;
+    }
 
-        // Check if trigger lifted. This is a small optimization in order to skip the remaining checks
-        if (is_trigger && !key_down) {
-            key_override_printf("Not activating override: Trigger lifted\n");
-            continue;
-        }
+    // Check allowed activation events
+    if (!check_activation_event(override, key_down, is_mod)) {
+        key_override_printf("Not activating override: Activation event not allowed\n");
+        return false;
+    }
 
-        // If the trigger is KC_NO it means 'no key', so only the required modifiers need to be down.
-        const bool no_trigger = override->trigger == KC_NO;
+    // Check if aleady active
+    if (override == active_override) {
+        key_override_printf("Not activating override: Alerady actived\n");
+        return false;
+    }
 
-        // Check if aleady active
-        if (override == active_override) {
-            key_override_printf("Not activating override: Alerady actived\n");
-            continue;
-        }
+    // Check if enabled
+    if (override->enabled != NULL && !((*(override->enabled) & 1))) {
+        key_override_printf("Not activating override: Not enabled\n");
+        return false;
+    }
+
+    // Check mods precisely
+    if (!key_override_matches_active_modifiers(override, active_mods)) {
+        key_override_printf("Not activating override: Modifiers don't match\n");
+        return false;
+    }
 
-        // Check if enabled
-        if (override->enabled != NULL && !((*(override->enabled) & 1))) {
-            key_override_printf("Not activating override: Not enabled\n");
-            continue;
+    return true;
+}
+
+/** Checks whether the trigger of the override is down. If no trigger key is required, if the trigger was just pressed, or if the last non-mod key that was pressed down is the trigger key, it is. */
+static bool is_trigger_down(const key_override_t *override, const uint16_t keycode, const bool key_down) {
+    if (override->trigger == keycode && !key_down) {
+        key_override_printf("Not activating override: Trigger lifted\n");
+        return false;
+    }
+    return override->trigger == KC_NO || override->trigger == keycode || last_key_down == override->trigger;
+}
+
+/** Finds the first override with the given trigger that can activate, before position `limit`. Returns `limit` if there is none. */
+static uint16_t find_override(const uint16_t trigger, uint16_t limit, const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods) {
+    // Find the first override with the trigger
+    uint16_t low = 0, high = index_size;
+    while (low < high) {
+        uint16_t mid = (low + high) / 2;
+        if (key_override_get(index_by_trigger[mid])->trigger < trigger) {
+            low = mid + 1;
+        } else {
+            high = mid;
         }
+    }
 
-        // Check mods precisely
-        if (!key_override_matches_active_modifiers(override, active_mods)) {
-            key_override_printf("Not activating override: Modifiers don't match\n");
-            continue;
+    for (; low < index_size && index_by_trigger[low] < limit; low++) {
+        const key_override_t *const override = key_override_get(index_by_trigger[low]);
+        if (override->trigger != trigger) {
+            break;
         }
+        if (can_activate_override(override, layer, key_down, is_mod, active_mods) && is_trigger_down(override, keycode, key_down)) {
+            return index_by_trigger[low];
+        }
+    }
+    return limit;
+}
 
-        // Check if trigger key is down.
-        const bool trigger_down = is_trigger && key_down;
+/** Finds the first key override that activates on this event, or NULL. Only overrides without a trigger, or triggered by the key of this event or the last key pressed down, can activate. */
+static const key_override_t *find_activating_override(const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods) {
+    if (key_override_count() != index_count) {
+        build_index();
+    }
 
-        // At this point, all requirements for activation are checked, except whether the trigger key is pressed. Now we check if the required trigger is down
-        // If no trigger key is required, yes.
-        // If the trigger was just pressed, yes.
-        // If the last non-mod key that was pressed down is the trigger key, yes.
-        bool should_activate = no_trigger || trigger_down || last_key_down == override->trigger;
+    // No override applies to this layer, or every override requires a mod that is not down
+    if ((index_layers & (1 << layer)) == 0 || (!index_modless && (index_mods & active_mods) == 0)) {
+        return NULL;
+    }
 
-        if (!should_activate) {
-            key_override_printf("Not activating override. Trigger not down\n");
-            continue;
+    uint16_t found = index_size;
+    if (index_size > KEY_OVERRIDE_INDEX_SIZE) {
+        for (found = 0; found < index_size; found++) {
+            const key_override_t *const override = key_override_get(found);
+            if (can_activate_override(override, layer, key_down, is_mod, active_mods) && is_trigger_down(override, keycode, key_down)) {
+                break;
+            }
+        }
+    } else {
+        found = find_override(KC_NO, found, keycode, layer, key_down, is_mod, active_mods);
+        if (key_down && keycode != KC_NO) {
+            found = find_override(keycode, found, keycode, layer, key_down, is_mod, active_mods);
         }
+        if (last_key_down != keycode && last_key_down != KC_NO) {
+            found = find_override(last_key_down, found, keycode, layer, key_down, is_mod, active_mods);
+        }
+    }
+
+    return found < index_size ? key_override_get(found) : NULL;
+}
+
+/** Finds the first key override that activates on this event and activates it. Returns true if the key action for `keycode` should be sent */
+static bool try_activating_override(const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *activated) {
+    const key_override_t *const override = find_activating_override(keycode, layer, key_down, is_mod, active_mods);
+
+    if (override == NULL) {
+        *activated = false;
+        return true;
+    }
+
+    // If the trigger is KC_NO it means 'no key', so only the required modifiers need to be down.
+    const bool no_trigger = override->trigger == KC_NO;
 
-        key_override_printf("Activating override\n");
+    // Check if trigger key is down.
+    const bool trigger_down = override->trigger == keycode && key_down;
 
-        clear_active_override(false);
+    key_override_printf("Activating override\n");
+
+    clear_active_override(false);
 
 #ifdef DUMMY_MOD_NEUTRALIZER_KEYCODE
-        // Send a dummy keycode before unregistering the modifier(s)
-        // so that suppressing the modifier(s) doesn't falsely get interpreted
-        // by the host OS as a tap of a modifier key.
-        // For example, unintended activations of the start menu on Windows when
-        // using a GUI+<kc> key override with suppressed mods.
-        neutralize_flashing_modifiers(active_mods);
+    // Send a dummy keycode before unregistering the modifier(s)
+    // so that suppressing the modifier(s) doesn't falsely get interpreted
+    // by the host OS as a tap of a modifier key.
+    // For example, unintended activations of the start menu on Windows when
+    // using a GUI+<kc> key override with suppressed mods.
+    neutralize_flashing_modifiers(active_mods);
 #endif
 
-        active_override                 = override;
-        active_override_trigger_is_down = true;
+    active_override                 = override;
+    active_override_trigger_is_down = true;
 
-        set_suppressed_override_mods(override->suppressed_mods);
+    set_suppressed_override_mods(override->suppressed_mods);
 
-        if (!trigger_down && !no_trigger) {
-            // When activating a key override the trigger is is always unregistered. In the case where the key that newly pressed is not the trigger key, we have to explicitly remove the trigger key from the keyboard report. If the trigger was just pressed down we simply suppress the event which also has the effect of the trigger key not being registered in the keyboard report.
-            if (IS_BASIC_KEYCODE(override->trigger)) {
-                del_key(override->trigger);
-            } else {
-                unregister_code(override->trigger);
-            }
+    if (!trigger_down && !no_trigger) {
+        // When activating a key override the trigger is is always unregistered. In the case where the key that newly pressed is not the trigger key, we have to explicitly remove the trigger key from the keyboard report. If the trigger was just pressed down we simply suppress the event which also has the effect of the trigger key not being registered in the keyboard report.
+        if (IS_BASIC_KEYCODE(override->trigger)) {
+            del_key(override->trigger);
+        } else {
+            unregister_code(override->trigger);
         }
+    }
 
-        const uint16_t mod_free_replacement = clear_mods_from(override->replacement);
+    const uint16_t mod_free_replacement = clear_mods_from(override->replacement);
 
-        bool register_replacement = mod_free_replacement != KC_NO &&   // KC_NO is never registered
-                                    mod_free_replacement < SAFE_RANGE; // Custom keycodes are never registered
+    bool register_replacement = mod_free_replacement != KC_NO &&   // KC_NO is never registered
+                                mod_free_replacement < SAFE_RANGE; // Custom keycodes are never registered
 
-        // Try firing the custom handler
-        if (override->custom_action != NULL) {
-            register_replacement &= override->custom_action(true, override->context);
-        }
+    // Try firing the custom handler
+    if (override->custom_action != NULL) {
+        register_replacement &= override->custom_action(true, override->context);
+    }
 
-        if (register_replacement) {
-            const uint8_t override_mods = extract_mod_bits(override->replacement);
-            set_weak_override_mods(override_mods);
+    if (register_replacement) {
+        const uint8_t override_mods = extract_mod_bits(override->replacement);
+        set_weak_override_mods(override_mods);
 
-            // If this is a modifier event that activates the key override we _always_ defer the actual full activation of the override
-            if (is_mod) {
-                key_override_printf("Deferring register replacement key\n");
-                schedule_deferred_register(mod_free_replacement);
-                send_keyboard_report();
+        // If this is a modifier event that activates the key override we _always_ defer the actual full activation of the override
+        if (is_mod) {
+            key_override_printf("Deferring register replacement key\n");
+            schedule_deferred_register(mod_free_replacement);
+            send_keyboard_report();
+        } else {
+            if (IS_BASIC_KEYCODE(mod_free_replacement)) {
+                add_key(mod_free_replacement);
             } else {
-                if (IS_BASIC_KEYCODE(mod_free_replacement)) {
-                    add_key(mod_free_replacement);
-                } else {
-                    key_override_printf("NOT KEY 2\n");
-                    send_keyboard_report();
-                    // On macOS there seems to be a race condition when it comes to the keyboard report and consumer keycodes. It seems the OS may recognize a consumer keycode before an updated keyboard report, even if the keyboard report is actually sent before the consumer key. I assume it is some sort of race condition because it happens infrequently and very irregularly. Waiting for about at least 10ms between sending the keyboard report and sending the consumer code has shown to fix this.
-                    wait_ms(10);
-                    register_code(mod_free_replacement);
-                }
+                key_override_printf("NOT KEY 2\n");
+                send_keyboard_report();
+                // On macOS there seems to be a race condition when it comes to the keyboard report and consumer keycodes. It seems the OS may recognize a consumer keycode before an updated keyboard report, even if the keyboard report is actually sent before the consumer key. I assume it is some sort of race condition because it happens infrequently and very irregularly. Waiting for about at least 10ms between sending the keyboard report and sending the consumer code has shown to fix this.
+                wait_ms(10);
+                register_code(mod_free_replacement);
             }
-        } else {
-            // If not registering the replacement key send keyboard report to update the unregistered keys.
-            send_keyboard_report();
         }
-
-        *activated = true;
-
-        // If the trigger is down, suppress the event so that it does not get added to the keyboard report.
-        return !trigger_down;
+    } else {
+        // If not registering the replacement key send keyboard report to update the unregistered keys.
+        send_keyboard_report();
     }
 
-    *activated = false;
+    *activated = true;
 
-    return true;
+    // If the trigger is down, suppress the event so that it does not get added to the keyboard report.
+    return !trigger_down;
 }
 
 void key_override_task(void) {
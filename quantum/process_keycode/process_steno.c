@@ -128,13 +128,13 @@ static const uint16_t combinedmap_second[] PROGMEM = {STN_S2, STN_KL, STN_WL, ST
 
 #ifdef STENO_ENABLE_ALL
 void steno_init(void) {
-    mode = eeprom_read_byte(EECONFIG_STENOMODE);
+    mode = eeconfig_read_byte(EECONFIG_STENOMODE);
 }
 
 void steno_set_mode(steno_mode_t new_mode) {
     steno_clear_chord();
     mode = new_mode;
-    eeprom_update_byte(EECONFIG_STENOMODE, mode);
+    eeconfig_update_byte(EECONFIG_STENOMODE, mode);
 }
 #endif // STENO_ENABLE_ALL
 
@@ -190,6 +190,12 @@ __attribute__((weak)) void post_process_record_user(uint16_t keycode, keyrecord_
 
 void shutdown_quantum(bool jump_to_bootloader) {
     clear_keyboard();
+#if defined(DYNAMIC_KEYMAP_ENABLE) && defined(DYNAMIC_KEYMAP_RAM_SHADOW)
+    dynamic_keymap_flush();
+#endif
+#ifdef EECONFIG_WRITE_BEHIND
+    eeconfig_write_behind_flush();
+#endif
 #if defined(MIDI_ENABLE) && defined(MIDI_BASIC)
     process_midi_all_notes_off();
 #endif
@@ -229,7 +235,16 @@ uint16_t get_record_keycode(keyrecord_t *record, bool update_layer_cache) {
         return record->keycode;
     }
 #endif
-    return get_event_keycode(record->event, update_layer_cache);
+#if !defined(NO_ACTION_LAYER) && !defined(STRICT_LAYER_RELEASE)
+    if (!disable_action_cache) {
+        if (!(record->event.pressed && update_layer_cache)) {
+            return get_event_keycode(record->event, false);
+        }
+        update_source_layers_cache(record->event.key, layer_switch_get_record_layer(record));
+    }
+#endif
+    // The layer stack is only walked once per record until the layers or keymap change
+    return layer_switch_get_record_keycode(record);
 }
 
 /* Convert event into usable keycode. Checks the layer cache to ensure that it
@@ -271,6 +286,17 @@ void post_process_record_quantum(keyrecord_t *record) {
     post_process_record_kb(keycode, record);
 }
 
+/* Handlers in the process_record_quantum() chain that only act on keycodes within a
+ * given range are skipped for every other keycode, instead of each switching on the
+ * keycode itself. Handlers that need to observe every event are called directly.
+ * Defining NO_PROCESS_RECORD_DISPATCH calls every handler for every keycode.
+ */
+#ifdef NO_PROCESS_RECORD_DISPATCH
+#    define PROCESS_RECORD_RANGE(handler, keycode, record, first, last) handler(keycode, record)
+#else
+#    define PROCESS_RECORD_RANGE(handler, keycode, record, first, last) ((keycode) < (first) || (keycode) > (last) || handler(keycode, record))
+#endif
+
 /* Core keycode function, hands off handling to other functions,
     then processes internal quantum keycodes, and then processes
     ACTIONs.                                                      */
@@ -330,32 +356,32 @@ bool process_record_quantum(keyrecord_t *record) {
             process_haptic(keycode, record) &&
 #endif
 #if defined(VIA_ENABLE)
-            process_record_via(keycode, record) &&
+            PROCESS_RECORD_RANGE(process_record_via, keycode, record, QK_MACRO, QK_MACRO_MAX) &&
 #endif
 #if defined(POINTING_DEVICE_ENABLE) && defined(POINTING_DEVICE_AUTO_MOUSE_ENABLE)
             process_auto_mouse(keycode, record) &&
 #endif
             process_record_kb(keycode, record) &&
 #if defined(SECURE_ENABLE)
-            process_secure(keycode, record) &&
+            PROCESS_RECORD_RANGE(process_secure, keycode, record, QK_SECURE_LOCK, QK_SECURE_REQUEST) &&
 #endif
 #if defined(SEQUENCER_ENABLE)
-            process_sequencer(keycode, record) &&
+            PROCESS_RECORD_RANGE(process_sequencer, keycode, record, QK_SEQUENCER, QK_SEQUENCER_MAX) &&
 #endif
 #if defined(MIDI_ENABLE) && defined(MIDI_ADVANCED)
-            process_midi(keycode, record) &&
+            PROCESS_RECORD_RANGE(process_midi, keycode, record, QK_MIDI, QK_MIDI_MAX) &&
 #endif
 #ifdef AUDIO_ENABLE
-            process_audio(keycode, record) &&
+            PROCESS_RECORD_RANGE(process_audio, keycode, record, QK_AUDIO, QK_AUDIO_MAX) &&
 #endif
 #if defined(BACKLIGHT_ENABLE)
-            process_backlight(keycode, record) &&
+            PROCESS_RECORD_RANGE(process_backlight, keycode, record, QK_LIGHTING, QK_LIGHTING_MAX) &&
 #endif
 #if defined(LED_MATRIX_ENABLE)
-            process_led_matrix(keycode, record) &&
+            PROCESS_RECORD_RANGE(process_led_matrix, keycode, record, QK_LIGHTING, QK_LIGHTING_MAX) &&
 #endif
 #ifdef STENO_ENABLE
-            process_steno(keycode, record) &&
+            PROCESS_RECORD_RANGE(process_steno, keycode, record, QK_STENO, QK_STENO_MAX) &&
 #endif
 #if (defined(AUDIO_ENABLE) || (defined(MIDI_ENABLE) && defined(MIDI_BASIC))) && !defined(NO_MUSIC_MODE)
             process_music(keycode, record) &&
@@ -370,7 +396,14 @@ bool process_record_quantum(keyrecord_t *record) {
             process_tap_dance(keycode, record) &&
 #endif
 #if defined(UNICODE_COMMON_ENABLE)
+#    if defined(UCIS_ENABLE)
+            // Captures every key while an input sequence is active.
             process_unicode_common(keycode, record) &&
+#    elif defined(UNICODE_ENABLE) || defined(UNICODEMAP_ENABLE)
+            PROCESS_RECORD_RANGE(process_unicode_common, keycode, record, QK_UNICODE_MODE_NEXT, QK_UNICODE_MAX) &&
+#    else
+            PROCESS_RECORD_RANGE(process_unicode_common, keycode, record, QK_UNICODE_MODE_NEXT, QK_UNICODE_MODE_EMACS) &&
+#    endif
 #endif
 #ifdef LEADER_ENABLE
             process_leader(keycode, record) &&
@@ -379,43 +412,43 @@ bool process_record_quantum(keyrecord_t *record) {
             process_auto_shift(keycode, record) &&
 #endif
 #ifdef DYNAMIC_TAPPING_TERM_ENABLE
-            process_dynamic_tapping_term(keycode, record) &&
+            PROCESS_RECORD_RANGE(process_dynamic_tapping_term, keycode, record, QK_DYNAMIC_TAPPING_TERM_PRINT, QK_DYNAMIC_TAPPING_TERM_DOWN) &&
 #endif
 #ifdef SPACE_CADET_ENABLE
             process_space_cadet(keycode, record) &&
 #endif
 #ifdef MAGIC_ENABLE
-            process_magic(keycode, record) &&
+            PROCESS_RECORD_RANGE(process_magic, keycode, record, QK_MAGIC, QK_MAGIC_MAX) &&
 #endif
 #ifdef GRAVE_ESC_ENABLE
-            process_grave_esc(keycode, record) &&
+            PROCESS_RECORD_RANGE(process_grave_esc, keycode, record, QK_GRAVE_ESCAPE, QK_GRAVE_ESCAPE) &&
 #endif
 #if defined(RGBLIGHT_ENABLE) || defined(RGB_MATRIX_ENABLE)
-            process_underglow(keycode, record) &&
+            PROCESS_RECORD_RANGE(process_underglow, keycode, record, QK_LIGHTING, QK_LIGHTING_MAX) &&
 #endif
 #if defined(RGB_MATRIX_ENABLE)
-            process_rgb_matrix(keycode, record) &&
+            PROCESS_RECORD_RANGE(process_rgb_matrix, keycode, record, QK_LIGHTING, QK_LIGHTING_MAX) &&
 #endif
 #ifdef JOYSTICK_ENABLE
-            process_joystick(keycode, record) &&
+            PROCESS_RECORD_RANGE(process_joystick, keycode, record, QK_JOYSTICK, QK_JOYSTICK_MAX) &&
 #endif
 #ifdef PROGRAMMABLE_BUTTON_ENABLE
-            process_programmable_button(keycode, record) &&
+            PROCESS_RECORD_RANGE(process_programmable_button, keycode, record, QK_PROGRAMMABLE_BUTTON, QK_PROGRAMMABLE_BUTTON_MAX) &&
 #endif
 #ifdef AUTOCORRECT_ENABLE
             process_autocorrect(keycode, record) &&
 #endif
 #ifdef TRI_LAYER_ENABLE
-            process_tri_layer(keycode, record) &&
+            PROCESS_RECORD_RANGE(process_tri_layer, keycode, record, QK_TRI_LAYER_LOWER, QK_TRI_LAYER_UPPER) &&
 #endif
 #if !defined(NO_ACTION_LAYER)
-            process_default_layer(keycode, record) &&
+            PROCESS_RECORD_RANGE(process_default_layer, keycode, record, QK_PERSISTENT_DEF_LAYER, QK_PERSISTENT_DEF_LAYER_MAX) &&
 #endif
 #ifdef LAYER_LOCK_ENABLE
             process_layer_lock(keycode, record) &&
 #endif
 #ifdef BLUETOOTH_ENABLE
-            process_connection(keycode, record) &&
+            PROCESS_RECORD_RANGE(process_connection, keycode, record, QK_CONNECTION, QK_CONNECTION_MAX) &&
 #endif
             true)) {
         return false;
@@ -527,6 +560,13 @@ __attribute__((weak)) bool shutdown_kb(bool jump_to_bootloader) {
 
 void suspend_power_down_quantum(void) {
     suspend_power_down_kb();
+#if defined(DYNAMIC_KEYMAP_ENABLE) && defined(DYNAMIC_KEYMAP_RAM_SHADOW)
+    // Don't leave keymap changes pending in case power goes away while suspended
+    dynamic_keymap_flush();
+#endif
+#ifdef EECONFIG_WRITE_BEHIND
+    eeconfig_write_behind_flush();
+#endif
 #ifndef NO_SUSPEND_POWER_DOWN
 // Turn off backlight
 #    ifdef BACKLIGHT_ENABLE
@@ -246,18 +246,30 @@ static bool encoder_handlers_master(matrix_row_t master_matrix[], matrix_row_t s
     bool okay = read_if_checksum_mismatch(GET_ENCODERS_CHECKSUM, GET_ENCODERS_DATA, &last_update, &temp_events, &split_shmem->encoders.events, sizeof(temp_events));
     if (okay) {
         if (last_checksum != split_shmem->encoders.checksum) {
-            bool    actioned = false;
-            uint8_t index;
-            bool    clockwise;
-            while (okay && encoder_dequeue_event_advanced(&split_shmem->encoders.events, &index, &clockwise)) {
-                okay &= encoder_queue_event(index, clockwise);
-                actioned = true;
+            encoder_events_t      *events   = &split_shmem->encoders.events;
+            split_encoder_drain_t *drain    = &split_shmem->encoders.drain;
+            uint8_t                dequeued = events->dequeued;
+            uint8_t                index;
+            bool                   clockwise;
+
+            // Skip the events already taken, in case the slave has queued more before acting on their drain
+            uint8_t taken = drain->dequeued - events->dequeued;
+            if (taken <= (uint8_t)(events->enqueued - events->dequeued)) {
+                while (taken-- > 0) {
+                    encoder_dequeue_event_advanced(events, &index, &clockwise);
+                }
             }
 
-            if (actioned) {
-                okay &= transport_exec(CMD_ENCODER_DRAIN);
+            // If they do not all fit yet, they are left on the slave and taken once there is room
+            if (encoder_queue_split_events(events)) {
+                if (events->dequeued != dequeued) {
+                    // Only release what was read here, as the slave may have queued more since
+                    drain->tail     = events->tail;
+                    drain->dequeued = events->dequeued;
+                    okay &= transport_write(CMD_ENCODER_DRAIN, drain, sizeof(split_encoder_drain_t));
+                }
+                last_checksum = split_shmem->encoders.checksum;
             }
-            last_checksum = split_shmem->encoders.checksum;
         }
     }
     return okay;
@@ -271,7 +283,8 @@ static void encoder_handlers_slave(matrix_row_t master_matrix[], matrix_row_t sl
 }
 
 static void encoder_handlers_slave_drain(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
-    encoder_signal_queue_drain();
+    const split_encoder_drain_t *drain = (const split_encoder_drain_t *)initiator2target_buffer;
+    encoder_signal_queue_drain(drain->tail, drain->dequeued);
 }
 
 // clang-format off
@@ -280,7 +293,7 @@ static void encoder_handlers_slave_drain(uint8_t initiator2target_buffer_size, c
 #    define TRANSACTIONS_ENCODERS_REGISTRATIONS \
     [GET_ENCODERS_CHECKSUM] = trans_target2initiator_initializer(encoders.checksum), \
     [GET_ENCODERS_DATA]     = trans_target2initiator_initializer(encoders.events), \
-    [CMD_ENCODER_DRAIN]     = trans_initiator2target_cb(encoder_handlers_slave_drain),
+    [CMD_ENCODER_DRAIN]     = trans_initiator2target_initializer_cb(encoders.drain, encoder_handlers_slave_drain),
 // clang-format on
 
 #else // ENCODER_ENABLE
@@ -347,8 +360,11 @@ static bool layer_state_handlers_master(matrix_row_t master_matrix[], matrix_row
 }
 
 static void layer_state_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    layer_state         = split_shmem->layers.layer_state;
-    default_layer_state = split_shmem->layers.default_layer_state;
+    if (layer_state != split_shmem->layers.layer_state || default_layer_state != split_shmem->layers.default_layer_state) {
+        layer_state         = split_shmem->layers.layer_state;
+        default_layer_state = split_shmem->layers.default_layer_state;
+        layer_switch_invalidate();
+    }
 }
 
 // clang-format off
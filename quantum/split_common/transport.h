@@ -64,9 +64,15 @@ typedef struct _split_master_matrix_sync_t {
 #endif // SPLIT_TRANSPORT_MIRROR
 
 #ifdef ENCODER_ENABLE
+typedef struct _split_encoder_drain_t {
+    uint8_t tail;
+    uint8_t dequeued;
+} split_encoder_drain_t;
+
 typedef struct _split_slave_encoder_sync_t {
-    uint8_t          checksum;
-    encoder_events_t events;
+    uint8_t               checksum;
+    encoder_events_t      events;
+    split_encoder_drain_t drain;
 } split_slave_encoder_sync_t;
 #endif // ENCODER_ENABLE
 
@@ -0,0 +1,19 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#define MATRIX_ROWS 4
+#define MATRIX_COLS 12
+
+#define A(bit) GPIO_TEST_PIN(0, bit)
+#define B(bit) GPIO_TEST_PIN(1, bit)
+#define C(bit) GPIO_TEST_PIN(2, bit)
+#define D(bit) GPIO_TEST_PIN(3, bit)
+
+// In-order and reversed runs, pins shared with the rows' port, and NO_PIN columns
+#define MATRIX_ROW_PINS \
+    { D(0), D(1), NO_PIN, D(3) }
+#define MATRIX_COL_PINS \
+    { A(0), A(1), A(2), NO_PIN, B(15), B(14), B(13), A(9), D(5), NO_PIN, C(0), A(3) }
+
+#define DIODE_DIRECTION COL2ROW
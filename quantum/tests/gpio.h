@@ -0,0 +1,40 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Emulated GPIO with 16 pins per port, for testing port-wide reads against per-pin reads
+typedef uint8_t  pin_t;
+typedef uint8_t  gpio_port_t;
+typedef uint16_t gpio_port_mask_t;
+
+#define NO_PIN (pin_t)(~0)
+
+#define GPIO_TEST_PIN(port, bit) ((pin_t)(((port) << 4) | (bit)))
+
+void             gpio_test_set_pin_input_high(pin_t pin);
+void             gpio_test_set_pin_output(pin_t pin);
+void             gpio_test_write_pin(pin_t pin, bool level);
+bool             gpio_test_read_pin(pin_t pin);
+gpio_port_mask_t gpio_test_read_port(gpio_port_t port);
+
+#define gpio_set_pin_input_high(pin) gpio_test_set_pin_input_high(pin)
+#define gpio_set_pin_output(pin) gpio_test_set_pin_output(pin)
+#define gpio_write_pin_high(pin) gpio_test_write_pin(pin, true)
+#define gpio_write_pin_low(pin) gpio_test_write_pin(pin, false)
+#define gpio_read_pin(pin) gpio_test_read_pin(pin)
+
+#define gpio_get_pin_port(pin) ((gpio_port_t)((pin) >> 4))
+#define gpio_get_pin_mask(pin) ((gpio_port_mask_t)(1 << ((pin)&0xF)))
+
+#define gpio_read_port(port) gpio_test_read_port(port)
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,149 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <cstring>
+#include <random>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "matrix.h"
+}
+
+namespace {
+const pin_t row_pins[MATRIX_ROWS] = MATRIX_ROW_PINS;
+const pin_t col_pins[MATRIX_COLS] = MATRIX_COL_PINS;
+
+// Pull-up inputs on the col pins, pulled low through a pressed key's diode when its row is driven low
+struct {
+    bool     output[64];
+    bool     level[64];
+    bool     forced_low[64];
+    bool     keys[MATRIX_ROWS][MATRIX_COLS];
+    uint32_t port_reads;
+} gpio;
+} // namespace
+
+extern "C" {
+void gpio_test_set_pin_input_high(pin_t pin) {
+    gpio.output[pin] = false;
+}
+
+void gpio_test_set_pin_output(pin_t pin) {
+    gpio.output[pin] = true;
+}
+
+void gpio_test_write_pin(pin_t pin, bool level) {
+    gpio.level[pin] = level;
+}
+
+bool gpio_test_read_pin(pin_t pin) {
+    if (gpio.output[pin]) {
+        return gpio.level[pin];
+    }
+    if (gpio.forced_low[pin]) {
+        return false;
+    }
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        if (col_pins[col] != pin) {
+            continue;
+        }
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            pin_t row_pin = row_pins[row];
+            if (gpio.keys[row][col] && row_pin != NO_PIN && gpio.output[row_pin] && !gpio.level[row_pin]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+gpio_port_mask_t gpio_test_read_port(gpio_port_t port) {
+    gpio_port_mask_t value = 0;
+    for (uint8_t bit = 0; bit < 16; bit++) {
+        value |= gpio_test_read_pin(GPIO_TEST_PIN(port, bit)) ? (1 << bit) : 0;
+    }
+    gpio.port_reads++;
+    return value;
+}
+}
+
+class MatrixCol2Row : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        std::memset(&gpio, 0, sizeof(gpio));
+        matrix_init();
+    }
+
+    // The row as read by selecting it and reading each col pin on its own
+    static matrix_row_t read_row_per_pin(uint8_t row) {
+        matrix_row_t value = 0;
+        if (row_pins[row] == NO_PIN) {
+            return value;
+        }
+        gpio_test_set_pin_output(row_pins[row]);
+        gpio_test_write_pin(row_pins[row], false);
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (col_pins[col] != NO_PIN && !gpio_test_read_pin(col_pins[col])) {
+                value |= MATRIX_ROW_SHIFTER << col;
+            }
+        }
+        gpio_test_set_pin_input_high(row_pins[row]);
+        return value;
+    }
+
+    static void expect_matches_per_pin_reads(void) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            EXPECT_EQ(matrix_get_row(row), read_row_per_pin(row)) << "Row " << (int)row;
+        }
+    }
+};
+
+TEST_F(MatrixCol2Row, EachKeyIsReportedInPlace) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            gpio.keys[row][col] = true;
+            matrix_scan();
+            expect_matches_per_pin_reads();
+            bool reachable = row_pins[row] != NO_PIN && col_pins[col] != NO_PIN;
+            EXPECT_EQ(matrix_is_on(row, col), reachable) << "Row " << (int)row << " col " << (int)col;
+            gpio.keys[row][col] = false;
+        }
+    }
+}
+
+TEST_F(MatrixCol2Row, RandomKeysMatchPerPinReads) {
+    std::mt19937 rng(44);
+    for (int i = 0; i < 2000; i++) {
+        gpio.keys[rng() % MATRIX_ROWS][rng() % MATRIX_COLS] ^= true;
+        matrix_scan();
+        expect_matches_per_pin_reads();
+    }
+}
+
+TEST_F(MatrixCol2Row, OtherPinsOnSharedPortsAreIgnored) {
+    // Unrelated pins on the col ports that read low, e.g. driven by other peripherals
+    for (pin_t pin : {GPIO_TEST_PIN(0, 4), GPIO_TEST_PIN(0, 15), GPIO_TEST_PIN(1, 0), GPIO_TEST_PIN(1, 12), GPIO_TEST_PIN(2, 1), GPIO_TEST_PIN(3, 6)}) {
+        gpio.forced_low[pin] = true;
+    }
+    gpio.keys[0][4]  = true;
+    gpio.keys[1][8]  = true;
+    gpio.keys[3][10] = true;
+    gpio.keys[3][11] = true;
+
+    matrix_scan();
+    expect_matches_per_pin_reads();
+    EXPECT_EQ(matrix_get_row(0), MATRIX_ROW_SHIFTER << 4);
+    EXPECT_EQ(matrix_get_row(1), MATRIX_ROW_SHIFTER << 8);
+    EXPECT_EQ(matrix_get_row(2), 0);
+    EXPECT_EQ(matrix_get_row(3), (MATRIX_ROW_SHIFTER << 10) | (MATRIX_ROW_SHIFTER << 11));
+}
+
+TEST_F(MatrixCol2Row, EachPortIsReadOncePerRow) {
+    gpio.port_reads = 0;
+    matrix_scan();
+#ifdef MATRIX_READ_PINS_INDIVIDUALLY
+    EXPECT_EQ(gpio.port_reads, 0);
+#else
+    // Three rows with pins, and cols on ports A, B, C and D
+    EXPECT_EQ(gpio.port_reads, 3 * 4);
+#endif
+}
@@ -0,0 +1,16 @@
+matrix_col2row_ports_DEFS := -DIGNORE_ATOMIC_BLOCK
+matrix_col2row_ports_CONFIG := $(QUANTUM_PATH)/tests/config_matrix.h
+matrix_col2row_ports_INC := $(QUANTUM_PATH)/tests
+
+matrix_col2row_ports_SRC := \
+	platforms/test/timer.c \
+	$(QUANTUM_PATH)/tests/matrix_tests.cpp \
+	$(QUANTUM_PATH)/debounce/none.c \
+	$(QUANTUM_PATH)/bitwise.c \
+	$(QUANTUM_PATH)/matrix_common.c \
+	$(QUANTUM_PATH)/matrix.c
+
+matrix_col2row_pins_DEFS := $(matrix_col2row_ports_DEFS) -DMATRIX_READ_PINS_INDIVIDUALLY
+matrix_col2row_pins_CONFIG := $(matrix_col2row_ports_CONFIG)
+matrix_col2row_pins_INC := $(matrix_col2row_ports_INC)
+matrix_col2row_pins_SRC := $(matrix_col2row_ports_SRC)
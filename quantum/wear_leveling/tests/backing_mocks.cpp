@@ -18,11 +18,13 @@ void MockBackingStore::reset_instance() {
     backing_max_write_count   = 0;
     backing_total_write_count = 0;
 
-    backing_init_invoke_count   = 0;
-    backing_unlock_invoke_count = 0;
-    backing_erase_invoke_count  = 0;
-    backing_write_invoke_count  = 0;
-    backing_lock_invoke_count   = 0;
+    backing_init_invoke_count         = 0;
+    backing_unlock_invoke_count       = 0;
+    backing_erase_invoke_count        = 0;
+    backing_erase_sector_invoke_count = 0;
+    backing_write_invoke_count        = 0;
+    backing_lock_invoke_count         = 0;
+    backing_read_invoke_count         = 0;
 
     init_success_callback   = [](std::uint64_t) { return true; };
     erase_success_callback  = [](std::uint64_t) { return true; };
@@ -75,6 +77,30 @@ bool MockBackingStore::erase(void) {
     return true;
 }
 
+bool MockBackingStore::erase_sector(uint32_t address) {
+    ++backing_erase_sector_invoke_count;
+
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+    EXPECT_TRUE(address % WEAR_LEVELING_BACKING_SECTOR_SIZE == 0) << "Supplied address was not aligned with the sector size";
+    EXPECT_TRUE(address + WEAR_LEVELING_BACKING_SECTOR_SIZE <= WEAR_LEVELING_BACKING_SIZE) << "Address would result of out-of-bounds access";
+    EXPECT_FALSE(is_locked()) << "Erase was attempted without being unlocked first";
+
+    // Drop out of erase early with failure if we need to, reusing the same callback as full erases
+    if (erase_success_callback && !erase_success_callback(backing_erase_invoke_count + backing_erase_sector_invoke_count)) {
+        return false;
+    }
+
+    std::size_t first = address / BACKING_STORE_WRITE_SIZE;
+    for (std::size_t i = 0; i < WEAR_LEVELING_BACKING_SECTOR_SIZE / BACKING_STORE_WRITE_SIZE; ++i) {
+        backing_storage[first + i].erase();
+    }
+    return true;
+#else
+    ADD_FAILURE() << "Sector erase is only used for incremental consolidation";
+    return false;
+#endif
+}
+
 bool MockBackingStore::write(uint32_t address, backing_store_int_t value) {
     ++backing_write_invoke_count;
 
@@ -114,6 +140,8 @@ bool MockBackingStore::lock(void) {
 }
 
 bool MockBackingStore::read(uint32_t address, backing_store_int_t& value) const {
+    ++backing_read_invoke_count;
+
     // precondition: value's buffer size already matches BACKING_STORE_WRITE_SIZE
     EXPECT_TRUE(address % BACKING_STORE_WRITE_SIZE == 0) << "Supplied address was not aligned with the backing store integral size";
     EXPECT_TRUE(address + BACKING_STORE_WRITE_SIZE <= WEAR_LEVELING_BACKING_SIZE) << "Address would result of out-of-bounds access";
@@ -125,6 +153,21 @@ bool MockBackingStore::read(uint32_t address, backing_store_int_t& value) const
     return true;
 }
 
+bool MockBackingStore::read_bulk(uint32_t address, backing_store_int_t* values, size_t item_count) const {
+    // Counted as a single transaction, as it would be on a peripheral supporting bulk reads
+    ++backing_read_invoke_count;
+
+    EXPECT_TRUE(address % BACKING_STORE_WRITE_SIZE == 0) << "Supplied address was not aligned with the backing store integral size";
+    EXPECT_TRUE(address + item_count * BACKING_STORE_WRITE_SIZE <= WEAR_LEVELING_BACKING_SIZE) << "Address would result of out-of-bounds access";
+
+    std::size_t index = address / BACKING_STORE_WRITE_SIZE;
+    for (std::size_t i = 0; i < item_count; ++i) {
+        values[i] = ~backing_storage[index + i].get();
+    }
+
+    return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Backing Implementation
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -141,6 +184,12 @@ extern "C" bool backing_store_erase(void) {
     return MockBackingStore::Instance().erase();
 }
 
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+extern "C" bool backing_store_erase_sector(uint32_t address) {
+    return MockBackingStore::Instance().erase_sector(address);
+}
+#endif
+
 extern "C" bool backing_store_write(uint32_t address, backing_store_int_t value) {
     return MockBackingStore::Instance().write(address, value);
 }
@@ -152,3 +201,7 @@ extern "C" bool backing_store_lock(void) {
 extern "C" bool backing_store_read(uint32_t address, backing_store_int_t* value) {
     return MockBackingStore::Instance().read(address, *value);
 }
+
+extern "C" bool backing_store_read_bulk(uint32_t address, backing_store_int_t* values, size_t item_count) {
+    return MockBackingStore::Instance().read_bulk(address, values, item_count);
+}
@@ -27,18 +27,21 @@ class MockBackingStoreElement {
     backing_store_int_t value;
     std::size_t         writes;
     std::size_t         erases;
+    std::size_t         cycles;
 
    public:
-    MockBackingStoreElement() : value(BACKING_STORE_INTEGRAL_COMPLEMENT::value), writes(0), erases(0) {}
+    MockBackingStoreElement() : value(BACKING_STORE_INTEGRAL_COMPLEMENT::value), writes(0), erases(0), cycles(0) {}
     void reset() {
         erase();
         writes = 0;
         erases = 0;
+        cycles = 0;
     }
     void erase() {
         if (!is_erased()) {
             ++erases;
         }
+        ++cycles;
         value = BACKING_STORE_INTEGRAL_COMPLEMENT::value;
     }
     backing_store_int_t get() const {
@@ -55,6 +58,10 @@ class MockBackingStoreElement {
     std::size_t num_erases() const {
         return erases;
     }
+    // Erase cycles endured, including erases of already-empty elements as flash still wears
+    std::size_t num_erase_cycles() const {
+        return cycles;
+    }
     bool is_erased() const {
         return value == BACKING_STORE_INTEGRAL_COMPLEMENT::value;
     }
@@ -94,8 +101,11 @@ class MockBackingStore {
     std::uint64_t backing_init_invoke_count;
     std::uint64_t backing_unlock_invoke_count;
     std::uint64_t backing_erase_invoke_count;
+    std::uint64_t backing_erase_sector_invoke_count;
     std::uint64_t backing_write_invoke_count;
     std::uint64_t backing_lock_invoke_count;
+    // Reads are const, but still need to be tracked
+    mutable std::uint64_t backing_read_invoke_count;
 
     // Whether init should succeed
     std::function<bool(std::uint64_t)> init_success_callback;
@@ -141,12 +151,18 @@ class MockBackingStore {
     std::uint64_t erase_invoke_count() const {
         return backing_erase_invoke_count;
     }
+    std::uint64_t erase_sector_invoke_count() const {
+        return backing_erase_sector_invoke_count;
+    }
     std::uint64_t write_invoke_count() const {
         return backing_write_invoke_count;
     }
     std::uint64_t lock_invoke_count() const {
         return backing_lock_invoke_count;
     }
+    std::uint64_t read_invoke_count() const {
+        return backing_read_invoke_count;
+    }
 
     // Clear out the internal data for the next run
     void reset_instance();
@@ -159,9 +175,11 @@ class MockBackingStore {
     bool init();
     bool unlock();
     bool erase();
+    bool erase_sector(std::uint32_t address);
     bool write(std::uint32_t address, backing_store_int_t value);
     bool lock();
     bool read(std::uint32_t address, backing_store_int_t& value) const;
+    bool read_bulk(std::uint32_t address, backing_store_int_t* values, std::size_t item_count) const;
 
     // Control over when init/writes/erases should succeed
     void set_init_callback(std::function<bool(std::uint64_t)> callback) {
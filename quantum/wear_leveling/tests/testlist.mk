@@ -3,4 +3,17 @@ TEST_LIST += \
 	wear_leveling_2byte_optimized_writes \
 	wear_leveling_2byte \
 	wear_leveling_4byte \
-	wear_leveling_8byte
+	wear_leveling_8byte \
+	wear_leveling_incremental
+
+# The endurance simulations are long-running reports rather than checks, so they are only built on request
+ifeq ($(strip $(WEAR_LEVELING_ENDURANCE)), yes)
+TEST_LIST += \
+	wear_leveling_endurance_2byte_ratio2 \
+	wear_leveling_endurance_2byte_ratio4 \
+	wear_leveling_endurance_4byte_ratio2 \
+	wear_leveling_endurance_4byte_ratio4 \
+	wear_leveling_endurance_8byte_ratio2 \
+	wear_leveling_endurance_8byte_ratio4 \
+	wear_leveling_endurance_2byte_incremental
+endif
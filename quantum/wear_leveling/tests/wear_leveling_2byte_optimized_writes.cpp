@@ -293,3 +293,32 @@ TEST_F(WearLeveling2ByteOptimizedWrites, PlaybackReadbackWord01_Success) {
     wear_leveling_read(0x02, &tmp, sizeof(tmp));
     EXPECT_EQ(tmp, 1) << "Failed to read back the seeded data";
 }
+
+/**
+ * This test benchmarks startup with a mostly-full write log, verifying that playback reads the backing store in bulk rather than once per log entry.
+ */
+TEST_F(WearLeveling2ByteOptimizedWrites, PlaybackBenchmark_BulkReads) {
+    auto& inst = MockBackingStore::Instance();
+    std::fill(verify_data.begin(), verify_data.end(), 0);
+
+    // Fill most of the write log with single-slot entries, alternating 0/1 so that every write is appended to the log
+    const std::size_t entries = ((WEAR_LEVELING_BACKING_SIZE - WEAR_LEVELING_LOGICAL_SIZE - 8) / BACKING_STORE_WRITE_SIZE) * 3 / 4;
+    for (std::size_t i = 0; i < entries; ++i) {
+        uint16_t value = ((i / 1000) + 1) & 1;
+        EXPECT_EQ(test_write((i % 1000) * 2, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write should not have consolidated";
+    }
+
+    auto reads = inst.read_invoke_count();
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Re-initialisation failed";
+    reads = inst.read_invoke_count() - reads;
+    RecordProperty("log_entries", (int)entries);
+    RecordProperty("read_transactions", (int)reads);
+
+    // Consolidated area and checksum, the end-of-log search, and one read per playback chunk
+    const std::size_t chunks = (entries * BACKING_STORE_WRITE_SIZE + WEAR_LEVELING_PLAYBACK_CHUNK_SIZE - 1) / WEAR_LEVELING_PLAYBACK_CHUNK_SIZE;
+    EXPECT_LE(reads, 2 + 32 + chunks) << "Playback should have read the write log in bulk";
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+    EXPECT_EQ(wear_leveling_read(0, readback.data(), WEAR_LEVELING_LOGICAL_SIZE), WEAR_LEVELING_SUCCESS) << "Failed to read back the saved data";
+    EXPECT_TRUE(memcmp(readback.data(), verify_data.data(), WEAR_LEVELING_LOGICAL_SIZE) == 0) << "Readback did not match";
+}
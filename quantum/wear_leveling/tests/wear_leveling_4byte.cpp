@@ -191,3 +191,30 @@ TEST_F(WearLeveling4Byte, PlaybackReadbackMultibyte_OOB) {
     EXPECT_EQ(buf[0], 0x11) << "Readback should have maintained the previous pre-failure value from the write log";
     EXPECT_EQ(buf[1], 0x12) << "Readback should have maintained the previous pre-failure value from the write log";
 }
+
+/**
+ * This test verifies that playback locates the end of the write log even when log entries contain zero-valued data, and that it uses bulk reads.
+ */
+TEST_F(WearLeveling4Byte, PlaybackFindsEndOfLog) {
+    auto& inst = MockBackingStore::Instance();
+    std::fill(verify_data.begin(), verify_data.end(), 0);
+
+    // Zero-valued data leaves the trailing backing store writes of a multibyte log entry empty
+    const std::uint8_t test_data[5] = {0x11, 0x00, 0x00, 0x00, 0x00};
+    EXPECT_EQ(test_write(0x01, test_data, sizeof(test_data)), WEAR_LEVELING_SUCCESS) << "Write should have succeeded";
+    auto next_address = std::prev(inst.log_end())->address + BACKING_STORE_WRITE_SIZE;
+
+    // Re-init, playing back the write log
+    auto reads = inst.read_invoke_count();
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Re-initialisation failed";
+    EXPECT_LE(inst.read_invoke_count() - reads, 12) << "Playback should have read the write log in bulk";
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+    EXPECT_EQ(wear_leveling_read(0, readback.data(), WEAR_LEVELING_LOGICAL_SIZE), WEAR_LEVELING_SUCCESS) << "Failed to read back the saved data";
+    EXPECT_TRUE(memcmp(readback.data(), verify_data.data(), WEAR_LEVELING_LOGICAL_SIZE) == 0) << "Readback did not match";
+
+    // The next write should be appended directly after the last log entry
+    uint8_t test_value = 0x13;
+    EXPECT_EQ(test_write(0x0E, &test_value, sizeof(test_value)), WEAR_LEVELING_SUCCESS) << "Write after playback should have succeeded";
+    EXPECT_EQ(std::prev(inst.log_end())->address, next_address) << "Invalid write log address after playback";
+}
@@ -0,0 +1,236 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <cstdio>
+#include <random>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+/*
+    Flash endurance simulation.
+
+    Runs a synthetic workload modelled on eeconfig, VIA and dynamic keymap
+    usage against the mock backing store for a number of simulated years, and
+    reports the resulting wear. Each build of this target covers a single
+    combination of write size, logical size and backing size.
+
+    Stall times are estimated from the number of backing store operations each
+    call performs, using the per-operation timings below, which should be set
+    to match the datasheet of the flash being evaluated.
+*/
+
+// Number of years to simulate
+#ifndef WEAR_LEVELING_ENDURANCE_YEARS
+#    define WEAR_LEVELING_ENDURANCE_YEARS 5
+#endif
+
+// Granularity used when reporting erase cycles
+#ifndef WEAR_LEVELING_ENDURANCE_SECTOR_SIZE
+#    ifdef WEAR_LEVELING_BACKING_SECTOR_SIZE
+#        define WEAR_LEVELING_ENDURANCE_SECTOR_SIZE WEAR_LEVELING_BACKING_SECTOR_SIZE
+#    else
+#        define WEAR_LEVELING_ENDURANCE_SECTOR_SIZE 1024
+#    endif
+#endif
+
+// Time taken by a single backing store write, in microseconds
+#ifndef WEAR_LEVELING_ENDURANCE_WRITE_US
+#    define WEAR_LEVELING_ENDURANCE_WRITE_US 40
+#endif
+
+// Time taken to erase a single sector, in microseconds
+#ifndef WEAR_LEVELING_ENDURANCE_ERASE_US
+#    define WEAR_LEVELING_ENDURANCE_ERASE_US 20000
+#endif
+
+// Rated erase cycles of the flash, used to project its lifetime
+#ifndef WEAR_LEVELING_ENDURANCE_RATED_CYCLES
+#    define WEAR_LEVELING_ENDURANCE_RATED_CYCLES 10000
+#endif
+
+static_assert(WEAR_LEVELING_BACKING_SIZE % WEAR_LEVELING_ENDURANCE_SECTOR_SIZE == 0, "Backing size must be a multiple of the simulated sector size");
+static_assert(WEAR_LEVELING_LOGICAL_SIZE >= 2048, "The simulated workload needs at least 2kB of logical storage");
+
+// Logical layout used by the workload
+#define ENDURANCE_EECONFIG_START 0
+#define ENDURANCE_EECONFIG_SIZE 40
+#define ENDURANCE_VIA_START 40
+#define ENDURANCE_VIA_SIZE 24
+#define ENDURANCE_KEYMAP_START 64
+#define ENDURANCE_KEYMAP_SIZE 1024
+#define ENDURANCE_MACRO_START (ENDURANCE_KEYMAP_START + ENDURANCE_KEYMAP_SIZE)
+#define ENDURANCE_MACRO_SIZE (WEAR_LEVELING_LOGICAL_SIZE - ENDURANCE_MACRO_START)
+
+class WearLevelingEndurance : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        wear_leveling_init();
+    }
+
+    // Estimated time spent in the backing store since the last call
+    std::uint64_t elapsed_us() {
+        auto&         inst   = MockBackingStore::Instance();
+        std::uint64_t writes = inst.write_invoke_count() - last_writes;
+        std::uint64_t erases = (inst.erase_invoke_count() - last_erases) * (WEAR_LEVELING_BACKING_SIZE / WEAR_LEVELING_ENDURANCE_SECTOR_SIZE) + (inst.erase_sector_invoke_count() - last_sector_erases);
+        last_writes          = inst.write_invoke_count();
+        last_erases          = inst.erase_invoke_count();
+        last_sector_erases   = inst.erase_sector_invoke_count();
+        return writes * WEAR_LEVELING_ENDURANCE_WRITE_US + erases * WEAR_LEVELING_ENDURANCE_ERASE_US;
+    }
+
+    // Writes new data, as eeprom_update_*() would, keeping track of the cost of the write
+    void write(std::uint32_t address, const std::uint8_t* data, std::size_t length) {
+        std::size_t changed = 0;
+        for (std::size_t i = 0; i < length; ++i) {
+            changed += shadow[address + i] != data[i] ? 1 : 0;
+        }
+        if (changed == 0) {
+            return;
+        }
+        memcpy(&shadow[address], data, length);
+
+        elapsed_us();
+        wear_leveling_status_t status = wear_leveling_write(address, data, length);
+        EXPECT_NE(status, WEAR_LEVELING_FAILED) << "Write should have succeeded";
+        worst_write_stall_us = std::max(worst_write_stall_us, elapsed_us());
+        logical_writes++;
+        logical_bytes += changed;
+
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+        // The main loop runs many times between writes, giving the background task ample opportunity to run
+        for (int i = 0; i < (WEAR_LEVELING_BANK_SIZE / WEAR_LEVELING_BACKING_SECTOR_SIZE) + 1; ++i) {
+            EXPECT_NE(wear_leveling_task(), WEAR_LEVELING_FAILED) << "Background task should have succeeded";
+            worst_task_stall_us = std::max(worst_task_stall_us, elapsed_us());
+        }
+#endif
+    }
+
+    void write_random(std::uint32_t start, std::uint32_t size, std::size_t length) {
+        std::uint8_t data[8];
+        for (std::size_t i = 0; i < length; ++i) {
+            data[i] = (std::uint8_t)rng();
+        }
+        write(start + rng() % (size - length + 1), data, length);
+    }
+
+    void simulate_day() {
+        // eeconfig: a handful of lighting, audio and keymap config changes
+        for (int i = rng() % 8; i > 0; --i) {
+            write_random(ENDURANCE_EECONFIG_START, ENDURANCE_EECONFIG_SIZE, 1 + rng() % 4);
+        }
+
+        // VIA: custom lighting values being saved every few days
+        if (rng() % 3 == 0) {
+            write_random(ENDURANCE_VIA_START, ENDURANCE_VIA_SIZE, 4);
+        }
+
+        // Dynamic keymap: an occasional remapping session, often to KC_NO/KC_TRNS
+        if (rng() % 14 == 0) {
+            for (int i = 1 + rng() % 30; i > 0; --i) {
+                std::uint32_t address = ENDURANCE_KEYMAP_START + (rng() % (ENDURANCE_KEYMAP_SIZE / 2)) * 2;
+                std::uint16_t keycode = rng() % 3 == 0 ? rng() % 2 : 4 + rng() % 0x100;
+                std::uint8_t  data[2] = {(std::uint8_t)(keycode >> 8), (std::uint8_t)keycode};
+                write(address, data, sizeof(data));
+            }
+        }
+
+        // Dynamic macros: rewritten about once a month, in VIA-sized chunks
+        if (rng() % 30 == 0) {
+            std::uint32_t length  = 28 * (1 + rng() % 8);
+            std::uint32_t address = ENDURANCE_MACRO_START + rng() % (ENDURANCE_MACRO_SIZE - length);
+            std::uint8_t  data[28];
+            for (std::uint32_t offset = 0; offset < length; offset += sizeof(data)) {
+                for (auto& b : data) {
+                    b = (std::uint8_t)(' ' + rng() % 0x5F);
+                }
+                write(address + offset, data, sizeof(data));
+            }
+        }
+    }
+
+    void verify() {
+        std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+        EXPECT_EQ(wear_leveling_read(0, readback.data(), readback.size()), WEAR_LEVELING_SUCCESS) << "Failed to read";
+        EXPECT_TRUE(readback == shadow) << "Readback did not match";
+    }
+
+    std::mt19937                                         rng{0x514D4B};
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> shadow{};
+    std::uint64_t                                        last_writes          = 0;
+    std::uint64_t                                        last_erases          = 0;
+    std::uint64_t                                        last_sector_erases   = 0;
+    std::uint64_t                                        logical_writes       = 0;
+    std::uint64_t                                        logical_bytes        = 0;
+    std::uint64_t                                        worst_write_stall_us = 0;
+    std::uint64_t                                        worst_task_stall_us  = 0;
+};
+
+/**
+ * This test simulates years of typical use, reporting flash wear, and verifying that data survives daily power cycles.
+ */
+TEST_F(WearLevelingEndurance, SimulatedYears) {
+    auto&     inst = MockBackingStore::Instance();
+    const int days = WEAR_LEVELING_ENDURANCE_YEARS * 365;
+
+    for (int day = 0; day < days; ++day) {
+        simulate_day();
+
+        // Power cycle at the end of every day
+        EXPECT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED) << "Re-initialisation failed";
+        elapsed_us();
+        verify();
+        if (HasFailure()) {
+            break;
+        }
+    }
+
+    // Erase cycles per sector
+    const std::size_t          sector_count = WEAR_LEVELING_BACKING_SIZE / WEAR_LEVELING_ENDURANCE_SECTOR_SIZE;
+    std::vector<std::uint64_t> sector_cycles(sector_count);
+    for (std::size_t i = 0; i < sector_count; ++i) {
+        auto begin       = inst.storage_begin() + i * (WEAR_LEVELING_ENDURANCE_SECTOR_SIZE / BACKING_STORE_WRITE_SIZE);
+        auto end         = begin + (WEAR_LEVELING_ENDURANCE_SECTOR_SIZE / BACKING_STORE_WRITE_SIZE);
+        sector_cycles[i] = std::max_element(begin, end, [](const MockBackingStoreElement& a, const MockBackingStoreElement& b) { return a.num_erase_cycles() < b.num_erase_cycles(); })->num_erase_cycles();
+    }
+    const std::uint64_t max_cycles = *std::max_element(sector_cycles.begin(), sector_cycles.end());
+
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+    const std::uint64_t consolidations = inst.erase_invoke_count() + inst.erase_sector_invoke_count() / (WEAR_LEVELING_BANK_SIZE / WEAR_LEVELING_BACKING_SECTOR_SIZE);
+#else
+    const std::uint64_t consolidations = inst.erase_invoke_count();
+#endif
+
+    const double physical_bytes      = (double)inst.write_invoke_count() * BACKING_STORE_WRITE_SIZE;
+    const double write_amplification = logical_bytes ? physical_bytes / logical_bytes : 0.0;
+    const double lifetime_years      = max_cycles ? (double)WEAR_LEVELING_ENDURANCE_RATED_CYCLES * WEAR_LEVELING_ENDURANCE_YEARS / max_cycles : 0.0;
+
+    printf("Wear-leveling endurance: write size %d, logical %d, backing %d (ratio %d)%s\n", BACKING_STORE_WRITE_SIZE, WEAR_LEVELING_LOGICAL_SIZE, WEAR_LEVELING_BACKING_SIZE, WEAR_LEVELING_BACKING_SIZE / WEAR_LEVELING_LOGICAL_SIZE,
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+           ", incremental consolidation"
+#else
+           ""
+#endif
+    );
+    printf("  Simulated:             %d years, %llu writes, %llu bytes changed\n", WEAR_LEVELING_ENDURANCE_YEARS, (unsigned long long)logical_writes, (unsigned long long)logical_bytes);
+    printf("  Consolidations:        %llu, every %.1f days\n", (unsigned long long)consolidations, consolidations ? (double)days / consolidations : 0.0);
+    printf("  Erase cycles / sector:");
+    for (auto cycles : sector_cycles) {
+        printf(" %llu", (unsigned long long)cycles);
+    }
+    printf("\n");
+    printf("  Worst write stall:     %.1f ms\n", worst_write_stall_us / 1000.0);
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+    printf("  Worst task stall:      %.1f ms\n", worst_task_stall_us / 1000.0);
+#endif
+    printf("  Write amplification:   %.2f\n", write_amplification);
+    printf("  Projected lifetime:    %.0f years at %d cycles\n", lifetime_years, WEAR_LEVELING_ENDURANCE_RATED_CYCLES);
+
+    RecordProperty("consolidations", (int)consolidations);
+    RecordProperty("max_erase_cycles", (int)max_cycles);
+    RecordProperty("worst_write_stall_us", (int)worst_write_stall_us);
+    RecordProperty("worst_task_stall_us", (int)worst_task_stall_us);
+    RecordProperty("write_amplification_x100", (int)(write_amplification * 100));
+
+    EXPECT_GT(consolidations, 0) << "The workload should have filled the write log at least once";
+}
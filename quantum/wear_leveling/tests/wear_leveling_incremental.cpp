@@ -0,0 +1,162 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <algorithm>
+#include <numeric>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+class WearLevelingIncremental : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        wear_leveling_init();
+    }
+
+    // Writes a distinct value to a rotating logical address, so that every call appends one entry to the write log
+    wear_leveling_status_t write_next(std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE>& expected) {
+        std::uint32_t address = counter % WEAR_LEVELING_LOGICAL_SIZE;
+        expected[address]     = (std::uint8_t)(0x40 + counter);
+        ++counter;
+        return wear_leveling_write(address, &expected[address], 1);
+    }
+
+    void verify_readback(const std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE>& expected) {
+        std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> actual;
+        EXPECT_EQ(wear_leveling_read(0, actual.data(), actual.size()), WEAR_LEVELING_SUCCESS) << "Failed to read";
+        for (int i = 0; i < WEAR_LEVELING_LOGICAL_SIZE; ++i) {
+            EXPECT_EQ(actual[i], expected[i]) << "Invalid readback at index " << i;
+        }
+    }
+
+    bool bank_erased(std::uint32_t bank) {
+        auto& inst  = MockBackingStore::Instance();
+        auto  begin = inst.storage_begin() + (bank / sizeof(backing_store_int_t));
+        auto  end   = begin + (WEAR_LEVELING_BANK_SIZE / sizeof(backing_store_int_t));
+        return std::any_of(begin, end, [](const MockBackingStoreElement& e) { return e.num_erases() > 0; });
+    }
+
+    bool bank_written(std::uint32_t bank) {
+        auto& inst  = MockBackingStore::Instance();
+        auto  begin = inst.storage_begin() + (bank / sizeof(backing_store_int_t));
+        auto  end   = begin + (WEAR_LEVELING_BANK_SIZE / sizeof(backing_store_int_t));
+        return std::any_of(begin, end, [](const MockBackingStoreElement& e) { return e.num_writes() > 0; });
+    }
+
+    std::uint32_t counter = 0;
+};
+
+/**
+ * This test verifies that pumping the background task while writing never requires a full erase of the backing store.
+ */
+TEST_F(WearLevelingIncremental, BackgroundConsolidation_NoFullErase) {
+    auto& inst = MockBackingStore::Instance();
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> expected{};
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_NE(write_next(expected), WEAR_LEVELING_FAILED) << "Write should have succeeded";
+        EXPECT_NE(wear_leveling_task(), WEAR_LEVELING_FAILED) << "Background task should have succeeded";
+    }
+
+    EXPECT_EQ(inst.erase_invoke_count(), 0) << "Full erase should not have been invoked";
+    EXPECT_GT(inst.erase_sector_invoke_count(), 0) << "Sector erase should have been invoked";
+    verify_readback(expected);
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback(expected);
+}
+
+/**
+ * This test verifies that the active bank keeps its data if power is lost while the inactive bank is being erased.
+ */
+TEST_F(WearLevelingIncremental, InterruptedErase_DataRetained) {
+    auto& inst = MockBackingStore::Instance();
+
+    // Fill the log until background consolidation kicks in, then only let it erase a single sector
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> expected{};
+    while (inst.erase_sector_invoke_count() == 0) {
+        EXPECT_EQ(write_next(expected), WEAR_LEVELING_SUCCESS) << "Write should not have consolidated";
+        EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Background task should have succeeded";
+    }
+
+    // Re-init, as if power was lost
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback(expected);
+    EXPECT_FALSE(bank_erased(0)) << "Active bank should not have been erased";
+}
+
+/**
+ * This test verifies that a failed generation counter write leaves the previous bank as the active one.
+ */
+TEST_F(WearLevelingIncremental, GenerationWriteFailure_PreviousBankUsed) {
+    auto& inst = MockBackingStore::Instance();
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> expected{};
+    while (inst.erase_sector_invoke_count() == 0) {
+        EXPECT_EQ(write_next(expected), WEAR_LEVELING_SUCCESS) << "Write should not have consolidated";
+        EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Background task should have succeeded";
+    }
+
+    // Fail writes to the generation counter of the inactive bank
+    inst.set_write_callback([](std::uint64_t count, std::uint32_t address) { return address < WEAR_LEVELING_BANK_SIZE + WEAR_LEVELING_LOGICAL_SIZE + 8 || address >= WEAR_LEVELING_BANK_SIZE + WEAR_LEVELING_LOG_START; });
+
+    wear_leveling_status_t status;
+    do {
+        status = wear_leveling_task();
+    } while (status == WEAR_LEVELING_SUCCESS);
+    EXPECT_EQ(status, WEAR_LEVELING_FAILED) << "Committing the inactive bank should have failed";
+
+    // Re-init, as if power was lost
+    inst.set_write_callback(nullptr);
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback(expected);
+
+    // Subsequent writes should still land in the original bank
+    uint8_t test_val = 0x99;
+    expected[0]      = test_val;
+    EXPECT_EQ(wear_leveling_write(0, &test_val, sizeof(test_val)), WEAR_LEVELING_SUCCESS) << "Write should have succeeded";
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback(expected);
+}
+
+/**
+ * This test verifies that filling the write log without pumping the background task performs the bank switch synchronously.
+ */
+TEST_F(WearLevelingIncremental, LogFull_SynchronousSwitch) {
+    auto& inst = MockBackingStore::Instance();
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> expected{};
+    wear_leveling_status_t                               status;
+    do {
+        status = write_next(expected);
+        EXPECT_NE(status, WEAR_LEVELING_FAILED) << "Write should have succeeded";
+    } while (status == WEAR_LEVELING_SUCCESS);
+
+    EXPECT_EQ(status, WEAR_LEVELING_CONSOLIDATED) << "Write should have consolidated";
+    EXPECT_EQ(inst.erase_invoke_count(), 0) << "Full erase should not have been invoked";
+    EXPECT_EQ(inst.erase_sector_invoke_count(), WEAR_LEVELING_BANK_SIZE / WEAR_LEVELING_BACKING_SECTOR_SIZE) << "Every sector of the inactive bank should have been erased";
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback(expected);
+}
+
+/**
+ * This test verifies that consecutive consolidations alternate between the two banks.
+ */
+TEST_F(WearLevelingIncremental, ConsolidationAlternatesBanks) {
+    auto& inst = MockBackingStore::Instance();
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> expected{};
+    while (write_next(expected) != WEAR_LEVELING_CONSOLIDATED) {
+    }
+    EXPECT_TRUE(bank_written(WEAR_LEVELING_BANK_SIZE)) << "Second bank should have been written first";
+    EXPECT_FALSE(bank_erased(0)) << "First bank should not have been erased";
+
+    while (write_next(expected) != WEAR_LEVELING_CONSOLIDATED) {
+    }
+    EXPECT_TRUE(bank_erased(0)) << "First bank should have been erased second";
+    EXPECT_EQ(inst.erase_sector_invoke_count(), 2 * WEAR_LEVELING_BANK_SIZE / WEAR_LEVELING_BACKING_SECTOR_SIZE) << "Each bank should have been erased once";
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    verify_readback(expected);
+}
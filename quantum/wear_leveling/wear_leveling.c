@@ -65,8 +65,10 @@
 
         During initialization:
             * The contents of the consolidated data section are read into cache.
+            * The end of the write log is located with a binary search.
             * The contents of the write log are "played back" and update the
-                cache accordingly.
+                cache accordingly. The log is read in bulk, in chunks of
+                WEAR_LEVELING_PLAYBACK_CHUNK_SIZE bytes.
 
         During reads:
             * Logical data is served from the cache.
@@ -153,7 +155,29 @@
         ║  │Address >> 1 ║
         ║  └── Value: 1  ║
         ╚════════════════╝
-        0 <= Address <= 0x3FFE (16382) */
+        0 <= Address <= 0x3FFE (16382)
+
+    Incremental consolidation (WEAR_LEVELING_INCREMENTAL_CONSOLIDATION):
+
+        The backing store is split into two equally-sized banks, each laid
+        out as above with an extra 8-byte generation counter between the
+        checksum and the write log. The generation counter is stored
+        alongside its complement so that a partially-written or erased
+        counter is never considered valid.
+
+        On startup, the bank with the newest valid generation is played
+        back. If neither bank has a valid generation, the first bank is used.
+
+        Once the write log of the active bank runs low, the other bank is
+        erased one sector at a time by wear_leveling_task(), while writes
+        continue to be appended to the active bank. When fully erased, the
+        cache is written to the other bank, followed by its checksum, and
+        lastly the incremented generation counter which commits the switch.
+        A power loss at any point before the generation counter is written
+        leaves the previous bank intact and newest.
+
+        If the write log fills before the background consolidation completes,
+        the remaining work is performed synchronously. */
 
 /**
  * Storage area for the wear-leveling cache.
@@ -162,8 +186,21 @@ static struct __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) {
     __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) uint8_t cache[(WEAR_LEVELING_LOGICAL_SIZE)];
     uint32_t                                                       write_address;
     bool                                                           unlocked;
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+    uint32_t bank_base;     // Start address of the active bank
+    uint32_t generation;    // Generation counter of the active bank
+    uint32_t erase_address; // Next sector of the inactive bank to be erased
+    bool     consolidating; // Whether the inactive bank is being prepared
+#endif
 } wear_leveling;
 
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+#    define WEAR_LEVELING_ACTIVE_BANK (wear_leveling.bank_base)
+#    define WEAR_LEVELING_INACTIVE_BANK ((WEAR_LEVELING_BANK_SIZE) - wear_leveling.bank_base)
+#else
+#    define WEAR_LEVELING_ACTIVE_BANK 0
+#endif
+
 /**
  * Locking helper: status
  */
@@ -202,7 +239,33 @@ static inline backing_store_lock_status_t wear_leveling_lock(void) {
  */
 static void wear_leveling_clear_cache(void) {
     memset(wear_leveling.cache, 0, (WEAR_LEVELING_LOGICAL_SIZE));
-    wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 is due to the FNV1a_64 of the consolidated buffer
+    wear_leveling.write_address = WEAR_LEVELING_ACTIVE_BANK + (WEAR_LEVELING_LOG_START);
+}
+
+/**
+ * Reads a full 8-byte entry from the backing store, such as the consolidated checksum.
+ */
+static bool wear_leveling_read_entry(uint32_t address, write_log_entry_t *entry) {
+#if BACKING_STORE_WRITE_SIZE == 2
+    return backing_store_read_bulk(address, entry->raw16, 4);
+#elif BACKING_STORE_WRITE_SIZE == 4
+    return backing_store_read_bulk(address, entry->raw32, 2);
+#elif BACKING_STORE_WRITE_SIZE == 8
+    return backing_store_read(address, &entry->raw64);
+#endif
+}
+
+/**
+ * Writes a full 8-byte entry to the backing store, such as the consolidated checksum.
+ */
+static bool wear_leveling_write_entry(uint32_t address, write_log_entry_t *entry) {
+#if BACKING_STORE_WRITE_SIZE == 2
+    return backing_store_write_bulk(address, entry->raw16, 4);
+#elif BACKING_STORE_WRITE_SIZE == 4
+    return backing_store_write_bulk(address, entry->raw32, 2);
+#elif BACKING_STORE_WRITE_SIZE == 8
+    return backing_store_write(address, entry->raw64);
+#endif
 }
 
 /**
@@ -213,7 +276,7 @@ static wear_leveling_status_t wear_leveling_read_consolidated(void) {
     wl_dprintf("Reading consolidated data\n");
 
     wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
-    if (!backing_store_read_bulk(0, (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t))) {
+    if (!backing_store_read_bulk(WEAR_LEVELING_ACTIVE_BANK, (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t))) {
         wl_dprintf("Failed to read from backing store\n");
         status = WEAR_LEVELING_FAILED;
     }
@@ -223,13 +286,7 @@ static wear_leveling_status_t wear_leveling_read_consolidated(void) {
         uint64_t          expected = fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT);
         write_log_entry_t entry;
         wl_dprintf("Reading checksum\n");
-#if BACKING_STORE_WRITE_SIZE == 2
-        backing_store_read_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw16, 4);
-#elif BACKING_STORE_WRITE_SIZE == 4
-        backing_store_read_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw32, 2);
-#elif BACKING_STORE_WRITE_SIZE == 8
-        backing_store_read((WEAR_LEVELING_LOGICAL_SIZE) + 0, &entry.raw64);
-#endif
+        wear_leveling_read_entry(WEAR_LEVELING_ACTIVE_BANK + (WEAR_LEVELING_LOGICAL_SIZE), &entry);
         // If we have a mismatch, clear the cache but do not flag a failure,
         // which will cater for the completely clean MCU case.
         if (entry.raw64 == expected) {
@@ -249,16 +306,16 @@ static wear_leveling_status_t wear_leveling_read_consolidated(void) {
 }
 
 /**
- * Writes the current cache to consolidated data at the beginning of the backing store.
+ * Writes the current cache to consolidated data at the beginning of the given bank of the backing store.
  * Does not clear the write log.
  * Pre-condition: this is just after an erase, so we can write directly without reading.
  */
-static wear_leveling_status_t wear_leveling_write_consolidated(void) {
+static wear_leveling_status_t wear_leveling_write_consolidated(uint32_t bank) {
     wl_dprintf("Writing consolidated data\n");
 
     backing_store_lock_status_t lock_status = wear_leveling_unlock();
     wear_leveling_status_t      status      = WEAR_LEVELING_CONSOLIDATED;
-    if (!backing_store_write_bulk(0, (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t))) {
+    if (!backing_store_write_bulk(bank, (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t))) {
         wl_dprintf("Failed to write to backing store\n");
         status = WEAR_LEVELING_FAILED;
     }
@@ -268,32 +325,146 @@ static wear_leveling_status_t wear_leveling_write_consolidated(void) {
         write_log_entry_t entry;
         entry.raw64 = fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT);
         wl_dprintf("Writing checksum\n");
-        do {
-#if BACKING_STORE_WRITE_SIZE == 2
-            if (!backing_store_write_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw16, 4)) {
-                status = WEAR_LEVELING_FAILED;
-                break;
-            }
-#elif BACKING_STORE_WRITE_SIZE == 4
-            if (!backing_store_write_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw32, 2)) {
-                status = WEAR_LEVELING_FAILED;
-                break;
-            }
-#elif BACKING_STORE_WRITE_SIZE == 8
-            if (!backing_store_write((WEAR_LEVELING_LOGICAL_SIZE), entry.raw64)) {
+        if (!wear_leveling_write_entry(bank + (WEAR_LEVELING_LOGICAL_SIZE), &entry)) {
+            status = WEAR_LEVELING_FAILED;
+        }
+    }
+
+    if (lock_status == STATUS_SUCCESS) {
+        wear_leveling_lock();
+    }
+    return status;
+}
+
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+/**
+ * Reads the generation counter of a bank.
+ *
+ * @return true if the bank has a valid generation counter
+ */
+static bool wear_leveling_read_generation(uint32_t bank, uint32_t *generation) {
+    write_log_entry_t entry;
+    if (!wear_leveling_read_entry(bank + (WEAR_LEVELING_LOGICAL_SIZE) + 8, &entry)) {
+        return false;
+    }
+    *generation = entry.raw32[0];
+    return entry.raw32[1] == ~entry.raw32[0];
+}
+
+/**
+ * Picks the bank with the newest valid generation counter as the active bank.
+ */
+static void wear_leveling_select_bank(void) {
+    uint32_t generation0 = 0;
+    uint32_t generation1 = 0;
+    bool     valid0      = wear_leveling_read_generation(0, &generation0);
+    bool     valid1      = wear_leveling_read_generation((WEAR_LEVELING_BANK_SIZE), &generation1);
+
+    if (valid1 && (!valid0 || (int32_t)(generation1 - generation0) > 0)) {
+        wear_leveling.bank_base  = (WEAR_LEVELING_BANK_SIZE);
+        wear_leveling.generation = generation1;
+    } else {
+        wear_leveling.bank_base  = 0;
+        wear_leveling.generation = valid0 ? generation0 : 0;
+    }
+    wear_leveling.consolidating = false;
+    wl_dprintf("Using bank at 0x%04X, generation %u\n", (int)wear_leveling.bank_base, (unsigned)wear_leveling.generation);
+}
+
+/**
+ * Performs one step of consolidation into the inactive bank: either erases a sector, or commits the cache once fully erased.
+ */
+static wear_leveling_status_t wear_leveling_consolidate_step(void) {
+    const uint32_t target = WEAR_LEVELING_INACTIVE_BANK;
+
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    if (lock_status == STATUS_FAILURE) {
+        wear_leveling_lock();
+        return WEAR_LEVELING_FAILED;
+    }
+
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+    if (wear_leveling.erase_address < target + (WEAR_LEVELING_BANK_SIZE)) {
+        wl_dprintf("Erasing sector at 0x%04X\n", (int)wear_leveling.erase_address);
+        if (backing_store_erase_sector(wear_leveling.erase_address)) {
+            wear_leveling.erase_address += (WEAR_LEVELING_BACKING_SECTOR_SIZE);
+        } else {
+            wl_dprintf("Failed to erase sector\n");
+            status = WEAR_LEVELING_FAILED;
+        }
+    } else {
+        // The generation counter is written last, committing the switch to the new bank
+        status = wear_leveling_write_consolidated(target);
+        if (status != WEAR_LEVELING_FAILED) {
+            write_log_entry_t entry;
+            entry.raw32[0] = wear_leveling.generation + 1;
+            entry.raw32[1] = ~entry.raw32[0];
+            wl_dprintf("Writing generation\n");
+            if (!wear_leveling_write_entry(target + (WEAR_LEVELING_LOGICAL_SIZE) + 8, &entry)) {
                 status = WEAR_LEVELING_FAILED;
-                break;
             }
-#endif
-        } while (0);
+        }
+
+        if (status == WEAR_LEVELING_FAILED) {
+            // The inactive bank may be partially written, so start over
+            wl_dprintf("Failed to commit consolidated data\n");
+            wear_leveling.erase_address = target;
+        } else {
+            wear_leveling.bank_base     = target;
+            wear_leveling.generation    = wear_leveling.generation + 1;
+            wear_leveling.write_address = target + (WEAR_LEVELING_LOG_START);
+            wear_leveling.consolidating = false;
+        }
     }
 
     if (lock_status == STATUS_SUCCESS) {
-        wear_leveling_lock();
+        if (wear_leveling_lock() == STATUS_FAILURE) {
+            status = WEAR_LEVELING_FAILED;
+        }
     }
     return status;
 }
 
+/**
+ * Starts preparing the inactive bank, if not already underway.
+ */
+static void wear_leveling_consolidate_begin(void) {
+    if (!wear_leveling.consolidating) {
+        wl_dprintf("Starting background consolidation\n");
+        wear_leveling.consolidating = true;
+        wear_leveling.erase_address = WEAR_LEVELING_INACTIVE_BANK;
+    }
+}
+
+/**
+ * Forces a write of the current cache into the inactive bank, completing any remaining steps synchronously.
+ * The active bank is left untouched until the inactive bank has been committed, so a power loss does not lose data.
+ */
+static wear_leveling_status_t wear_leveling_consolidate_force(void) {
+    wear_leveling_consolidate_begin();
+
+    wear_leveling_status_t status;
+    do {
+        status = wear_leveling_consolidate_step();
+    } while (status == WEAR_LEVELING_SUCCESS);
+
+    return status;
+}
+
+/**
+ * Performs one step of any pending background consolidation.
+ */
+wear_leveling_status_t wear_leveling_task(void) {
+    if (!wear_leveling.consolidating) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+    // Leave the backing store alone while a previous erase is still completing, rather than blocking on it
+    if (backing_store_is_busy()) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+    return wear_leveling_consolidate_step();
+}
+#else
 /**
  * Forces a write of the current cache.
  * Erases the backing store, including the write log.
@@ -310,16 +481,17 @@ static wear_leveling_status_t wear_leveling_consolidate_force(void) {
     }
 
     // Write the cache to the first section of the backing store.
-    wear_leveling_status_t status = wear_leveling_write_consolidated();
+    wear_leveling_status_t status = wear_leveling_write_consolidated(0);
     if (status == WEAR_LEVELING_FAILED) {
         wl_dprintf("Failed to write consolidated data\n");
     }
 
     // Next write of the log occurs after the consolidated values at the start of the backing store.
-    wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
+    wear_leveling.write_address = (WEAR_LEVELING_LOG_START);
 
     return status;
 }
+#endif // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
 
 /**
  * Potential write of the current cache to the backing store.
@@ -329,10 +501,17 @@ static wear_leveling_status_t wear_leveling_consolidate_force(void) {
  * @return true if consolidation occurred
  */
 static wear_leveling_status_t wear_leveling_consolidate_if_needed(void) {
-    if (wear_leveling.write_address >= (WEAR_LEVELING_BACKING_SIZE)) {
+    if (wear_leveling.write_address >= WEAR_LEVELING_ACTIVE_BANK + (WEAR_LEVELING_LOG_END)) {
         return wear_leveling_consolidate_force();
     }
 
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+    // Start preparing the other bank while there's still room left in the write log
+    if (wear_leveling.write_address + (WEAR_LEVELING_CONSOLIDATION_RESERVE) >= WEAR_LEVELING_ACTIVE_BANK + (WEAR_LEVELING_LOG_END)) {
+        wear_leveling_consolidate_begin();
+    }
+#endif
+
     return WEAR_LEVELING_SUCCESS;
 }
 
@@ -469,18 +648,106 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
     return status;
 }
 
+/**
+ * Read-ahead buffer used while playing back the write log, so that the backing store is read in bulk.
+ */
+typedef struct wear_leveling_playback_t {
+    backing_store_int_t buffer[(WEAR_LEVELING_PLAYBACK_CHUNK_SIZE) / (BACKING_STORE_WRITE_SIZE)];
+    uint32_t            buffer_start; // Backing store address of buffer[0]
+    uint32_t            buffer_end;   // Backing store address just past the last valid buffer entry
+    uint32_t            log_end;      // Backing store address past which the write log is known to be empty
+} wear_leveling_playback_t;
+
+/**
+ * Finds the end of the write log with a binary search, rather than reading every slot.
+ *
+ * Every log entry starts with a nonzero value, and is at most 8 bytes long, so a run of 8 bytes of zeros can only
+ * occur after the last entry in the log. The resulting address is such that everything after it is empty.
+ *
+ * @return true if the backing store could be read
+ */
+static bool wear_leveling_find_log_end(uint32_t *log_end) {
+    const uint32_t      write_size = (BACKING_STORE_WRITE_SIZE);
+    uint32_t            lo         = WEAR_LEVELING_ACTIVE_BANK + (WEAR_LEVELING_LOG_START);
+    uint32_t            hi         = WEAR_LEVELING_ACTIVE_BANK + (WEAR_LEVELING_LOG_END);
+    backing_store_int_t probe[8 / (BACKING_STORE_WRITE_SIZE)];
+
+    // Invariant: the log contains data before lo, and is empty from hi onwards
+    while (lo < hi) {
+        uint32_t mid   = lo + (((hi - lo) / write_size) / 2) * write_size;
+        size_t   count = sizeof(probe) / sizeof(backing_store_int_t);
+        if (mid + count * write_size > hi) {
+            count = (hi - mid) / write_size;
+        }
+        if (!backing_store_read_bulk(mid, probe, count)) {
+            return false;
+        }
+
+        bool empty = true;
+        for (size_t i = 0; i < count; ++i) {
+            if (probe[i] != 0) {
+                empty = false;
+                break;
+            }
+        }
+
+        if (empty) {
+            hi = mid;
+        } else {
+            lo = mid + write_size;
+        }
+    }
+
+    *log_end = lo;
+    return true;
+}
+
+/**
+ * Reads a single value of the write log during playback, refilling the read-ahead buffer as required.
+ * Anything past the end of the log is known to be empty, and is returned as zero without touching the backing store.
+ */
+static bool wear_leveling_playback_read(wear_leveling_playback_t *playback, uint32_t address, backing_store_int_t *value) {
+    if (address >= playback->log_end) {
+        *value = 0;
+        return true;
+    }
+
+    if (address < playback->buffer_start || address >= playback->buffer_end) {
+        uint32_t length = playback->log_end - address;
+        if (length > sizeof(playback->buffer)) {
+            length = sizeof(playback->buffer);
+        }
+        if (!backing_store_read_bulk(address, playback->buffer, length / (BACKING_STORE_WRITE_SIZE))) {
+            playback->buffer_end = playback->buffer_start;
+            return false;
+        }
+        playback->buffer_start = address;
+        playback->buffer_end   = address + length;
+    }
+
+    *value = playback->buffer[(address - playback->buffer_start) / (BACKING_STORE_WRITE_SIZE)];
+    return true;
+}
+
 /**
  * "Replays" the write log from the backing store, updating the local cache with updated values.
  */
 static wear_leveling_status_t wear_leveling_playback_log(void) {
     wl_dprintf("Playback write log\n");
 
-    wear_leveling_status_t status          = WEAR_LEVELING_SUCCESS;
-    bool                   cancel_playback = false;
-    uint32_t               address         = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
-    while (!cancel_playback && address < (WEAR_LEVELING_BACKING_SIZE)) {
+    wear_leveling_status_t   status          = WEAR_LEVELING_SUCCESS;
+    bool                     cancel_playback = false;
+    uint32_t                 address         = WEAR_LEVELING_ACTIVE_BANK + (WEAR_LEVELING_LOG_START);
+    wear_leveling_playback_t playback        = {.buffer_start = 0, .buffer_end = 0};
+    if (!wear_leveling_find_log_end(&playback.log_end)) {
+        wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
+        cancel_playback = true;
+        status          = WEAR_LEVELING_FAILED;
+    }
+
+    while (!cancel_playback && address < WEAR_LEVELING_ACTIVE_BANK + (WEAR_LEVELING_LOG_END)) {
         backing_store_int_t value;
-        bool                ok = backing_store_read(address, &value);
+        bool                ok = wear_leveling_playback_read(&playback, address, &value);
         if (!ok) {
             wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
             cancel_playback = true;
@@ -509,7 +776,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
         switch (LOG_ENTRY_GET_TYPE(log)) {
             case LOG_ENTRY_TYPE_MULTIBYTE: {
 #if BACKING_STORE_WRITE_SIZE == 2
-                ok = backing_store_read(address, &log.raw16[1]);
+                ok = wear_leveling_playback_read(&playback, address, &log.raw16[1]);
                 if (!ok) {
                     wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                     cancel_playback = true;
@@ -529,7 +796,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
 
 #if BACKING_STORE_WRITE_SIZE == 2
                 if (l > 1) {
-                    ok = backing_store_read(address, &log.raw16[2]);
+                    ok = wear_leveling_playback_read(&playback, address, &log.raw16[2]);
                     if (!ok) {
                         wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                         cancel_playback = true;
@@ -539,7 +806,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
                     address += (BACKING_STORE_WRITE_SIZE);
                 }
                 if (l > 3) {
-                    ok = backing_store_read(address, &log.raw16[3]);
+                    ok = wear_leveling_playback_read(&playback, address, &log.raw16[3]);
                     if (!ok) {
                         wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                         cancel_playback = true;
@@ -550,7 +817,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
                 }
 #elif BACKING_STORE_WRITE_SIZE == 4
                 if (l > 1) {
-                    ok = backing_store_read(address, &log.raw32[1]);
+                    ok = wear_leveling_playback_read(&playback, address, &log.raw32[1]);
                     if (!ok) {
                         wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                         cancel_playback = true;
@@ -617,6 +884,11 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
 wear_leveling_status_t wear_leveling_init(void) {
     wl_dprintf("Init\n");
 
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+    wear_leveling.bank_base     = 0;
+    wear_leveling.consolidating = false;
+#endif
+
     // Reset the cache
     wear_leveling_clear_cache();
 
@@ -627,6 +899,12 @@ wear_leveling_status_t wear_leveling_init(void) {
         return WEAR_LEVELING_FAILED;
     }
 
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+    // Work out which bank holds the latest data
+    wear_leveling_select_bank();
+    wear_leveling_clear_cache();
+#endif
+
     // Read the previous consolidated values, then replay the existing write log so that the cache has the "live" values
     wear_leveling_status_t status = wear_leveling_read_consolidated();
     if (status == WEAR_LEVELING_FAILED) {
@@ -661,6 +939,11 @@ wear_leveling_status_t wear_leveling_erase(void) {
 
     // Perform the erase
     bool ret = backing_store_erase();
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+    wear_leveling.bank_base     = 0;
+    wear_leveling.generation    = 0;
+    wear_leveling.consolidating = false;
+#endif
     wear_leveling_clear_cache();
 
     // Lock the backing store if we acquired the lock successfully
@@ -755,6 +1038,15 @@ __attribute__((weak)) bool backing_store_read_bulk(uint32_t address, backing_sto
     return true;
 }
 
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+/**
+ * Weak implementation of the busy check, for drivers whose erases complete synchronously.
+ */
+__attribute__((weak)) bool backing_store_is_busy(void) {
+    return false;
+}
+#endif // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+
 /**
  * Weak implementation of bulk write, drivers can implement more optimised implementations.
  */
@@ -52,3 +52,15 @@ wear_leveling_status_t wear_leveling_write(uint32_t address, const void* value,
  * @return Status of the request
  */
 wear_leveling_status_t wear_leveling_read(uint32_t address, void* value, size_t length);
+
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+/**
+ * Performs one step of any pending background consolidation.
+ *
+ * Each call erases at most one sector of the inactive bank, or once it is fully erased, writes the cache to it and
+ * switches over. Intended to be called periodically from the main loop.
+ *
+ * @return Status of the request, WEAR_LEVELING_CONSOLIDATED once the switch to the other bank has occurred
+ */
+wear_leveling_status_t wear_leveling_task(void);
+#endif
@@ -66,6 +66,44 @@ _Static_assert(WEAR_LEVELING_BACKING_SIZE >= (WEAR_LEVELING_LOGICAL_SIZE * 2), "
 _Static_assert(WEAR_LEVELING_LOGICAL_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Logical size must be a multiple of write size");
 _Static_assert(WEAR_LEVELING_BACKING_SIZE % WEAR_LEVELING_LOGICAL_SIZE == 0, "Backing size must be a multiple of logical size");
 
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+// The backing store is split into two banks, each holding consolidated data, its checksum, a generation counter and a write log
+#    ifndef WEAR_LEVELING_BACKING_SECTOR_SIZE
+#        error WEAR_LEVELING_BACKING_SECTOR_SIZE was not set, the backing store must support erasing individual sectors.
+#    endif
+#    define WEAR_LEVELING_BANK_SIZE ((WEAR_LEVELING_BACKING_SIZE) / 2)
+#    define WEAR_LEVELING_LOG_START ((WEAR_LEVELING_LOGICAL_SIZE) + 16) // +16 due to the FNV1a_64 of the consolidated area and the generation counter
+_Static_assert(WEAR_LEVELING_BANK_SIZE % WEAR_LEVELING_BACKING_SECTOR_SIZE == 0, "Bank size (half the backing size) must be a multiple of the sector size");
+_Static_assert(WEAR_LEVELING_BANK_SIZE >= (WEAR_LEVELING_LOGICAL_SIZE * 2), "Bank size (half the backing size) must be at least twice the size of the logical size");
+#else
+#    define WEAR_LEVELING_BANK_SIZE (WEAR_LEVELING_BACKING_SIZE)
+#    define WEAR_LEVELING_LOG_START ((WEAR_LEVELING_LOGICAL_SIZE) + 8) // +8 due to the FNV1a_64 of the consolidated area
+#endif // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+
+// Optionally caps the length of the write log, bounding the amount of data played back on startup at the cost of more frequent consolidation
+#ifdef WEAR_LEVELING_MAX_LOG_SIZE
+_Static_assert(WEAR_LEVELING_MAX_LOG_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Maximum log size must be a multiple of write size");
+_Static_assert(WEAR_LEVELING_MAX_LOG_SIZE >= 8, "Maximum log size must fit at least one full log entry");
+#    define WEAR_LEVELING_LOG_END (((WEAR_LEVELING_LOG_START) + (WEAR_LEVELING_MAX_LOG_SIZE)) < (WEAR_LEVELING_BANK_SIZE) ? ((WEAR_LEVELING_LOG_START) + (WEAR_LEVELING_MAX_LOG_SIZE)) : (WEAR_LEVELING_BANK_SIZE))
+#else
+#    define WEAR_LEVELING_LOG_END (WEAR_LEVELING_BANK_SIZE)
+#endif // WEAR_LEVELING_MAX_LOG_SIZE
+
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+// Consolidation into the other bank starts once fewer than this many bytes of the write log remain
+#    ifndef WEAR_LEVELING_CONSOLIDATION_RESERVE
+#        define WEAR_LEVELING_CONSOLIDATION_RESERVE ((((WEAR_LEVELING_LOG_END) - (WEAR_LEVELING_LOG_START)) / 4) & ~((BACKING_STORE_WRITE_SIZE)-1))
+#    endif
+_Static_assert(WEAR_LEVELING_CONSOLIDATION_RESERVE < (WEAR_LEVELING_LOG_END) - (WEAR_LEVELING_LOG_START), "Consolidation reserve must be smaller than the write log");
+#endif // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+
+// Number of bytes of the write log read from the backing store at a time during playback
+#ifndef WEAR_LEVELING_PLAYBACK_CHUNK_SIZE
+#    define WEAR_LEVELING_PLAYBACK_CHUNK_SIZE 64
+#endif
+_Static_assert(WEAR_LEVELING_PLAYBACK_CHUNK_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Playback chunk size must be a multiple of write size");
+_Static_assert(WEAR_LEVELING_PLAYBACK_CHUNK_SIZE >= 8, "Playback chunk size must fit at least one full log entry");
+
 // Backing Store API, to be implemented elsewhere by flash driver etc.
 bool backing_store_init(void);
 bool backing_store_unlock(void);
@@ -75,6 +113,10 @@ bool backing_store_write_bulk(uint32_t address, backing_store_int_t* values, siz
 bool backing_store_lock(void);
 bool backing_store_read(uint32_t address, backing_store_int_t* value);
 bool backing_store_read_bulk(uint32_t address, backing_store_int_t* values, size_t item_count); // weak implementation already provided, optimized implementation can be implemented by driver
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+bool backing_store_erase_sector(uint32_t address); // erases the WEAR_LEVELING_BACKING_SECTOR_SIZE sector starting at address
+bool backing_store_is_busy(void);                  // weak implementation already provided, drivers with asynchronous erases report whether one is still in progress
+#endif
 
 /**
  * Helper type used to contain a write log entry.
@@ -0,0 +1,229 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "process_autocorrect.h"
+#include "autocorrect_data_default.h"
+}
+
+using ::testing::_;
+using ::testing::AnyNumber;
+
+struct Correction {
+    uint8_t     backspaces;
+    std::string str;
+    std::string typo;
+    std::string correct;
+
+    bool operator==(const Correction &other) const {
+        return backspaces == other.backspaces && str == other.str && typo == other.typo && correct == other.correct;
+    }
+};
+
+std::ostream &operator<<(std::ostream &os, const Correction &c) {
+    return os << "{" << +c.backspaces << ", \"" << c.str << "\", \"" << c.typo << "\", \"" << c.correct << "\"}";
+}
+
+static std::vector<Correction> applied;
+
+extern "C" bool apply_autocorrect(uint8_t backspaces, const char *str, char *typo, char *correct) {
+    applied.push_back({backspaces, str, typo, correct});
+    return true;
+}
+
+// Reference implementation, walking the whole buffer backwards through the reversed trie on every key
+class TrieReference {
+   public:
+    std::vector<Correction> corrections;
+
+    void process(uint8_t keycode) {
+        switch (keycode) {
+            case KC_A ... KC_Z:
+            case KC_QUOTE:
+                break;
+            case KC_1 ... KC_0:
+            case KC_SPACE:
+                keycode = KC_SPC;
+                break;
+            case KC_ENTER:
+                size    = 0;
+                keycode = KC_SPC;
+                break;
+            case KC_BSPC:
+                if (size > 0) {
+                    --size;
+                }
+                return;
+            default:
+                size = 0;
+                return;
+        }
+
+        if (size >= AUTOCORRECT_MAX_LENGTH) {
+            memmove(buffer, buffer + 1, AUTOCORRECT_MAX_LENGTH - 1);
+            size = AUTOCORRECT_MAX_LENGTH - 1;
+        }
+        buffer[size++] = keycode;
+        if (size < AUTOCORRECT_MIN_LENGTH) {
+            return;
+        }
+
+        uint16_t state = 0;
+        uint8_t  code  = autocorrect_data[state];
+        for (int i = size - 1; i >= 0; --i) {
+            uint8_t key = buffer[i];
+            if (code & 64) {
+                code &= 63;
+                for (; code != key; code = autocorrect_data[state += 3]) {
+                    if (!code) return;
+                }
+                state = autocorrect_data[state + 1] | autocorrect_data[state + 2] << 8;
+            } else if (code != key) {
+                return;
+            } else if (!(code = autocorrect_data[++state])) {
+                ++state;
+            }
+
+            code = autocorrect_data[state];
+            if (code & 128) {
+                record(code & 63, (const char *)&autocorrect_data[state + 1]);
+                if (keycode == KC_SPC) {
+                    buffer[0] = KC_SPC;
+                    size      = 1;
+                } else {
+                    size = 0;
+                }
+                return;
+            }
+        }
+    }
+
+   private:
+    uint8_t buffer[AUTOCORRECT_MAX_LENGTH] = {KC_SPC};
+    uint8_t size                           = 1;
+
+    void record(uint8_t backspaces, const char *str) {
+        bool        space_last = buffer[size - 1] == KC_SPC;
+        std::string typo;
+        uint8_t     start = 0;
+        for (uint8_t i = size - 1; i > 0; --i) {
+            if (buffer[i - 1] == KC_SPC) {
+                start = i;
+                break;
+            }
+        }
+        for (uint8_t i = start; i < size - space_last; ++i) {
+            typo += (char)(buffer[i] - KC_A + 'a');
+        }
+        uint8_t offset = space_last ? backspaces : backspaces + 1;
+        corrections.push_back({backspaces, str, typo, typo.substr(0, typo.size() - offset) + str});
+    }
+};
+
+class AutoCorrectCorpus : public TestFixture {
+   public:
+    void SetUp() override {
+        autocorrect_enable();
+        applied.clear();
+    }
+
+    static void tap(uint8_t keycode) {
+        keyrecord_t record   = {};
+        record.event.pressed = true;
+        record.event.type    = KEY_EVENT;
+        process_autocorrect(keycode, &record);
+    }
+
+    static void append(std::vector<uint8_t> &keys, const char *text) {
+        for (; *text; ++text) {
+            switch (*text) {
+                case ' ':
+                    keys.push_back(KC_SPACE);
+                    break;
+                case '\'':
+                    keys.push_back(KC_QUOTE);
+                    break;
+                case '\b':
+                    keys.push_back(KC_BSPC);
+                    break;
+                case '\n':
+                    keys.push_back(KC_ENTER);
+                    break;
+                default:
+                    keys.push_back(KC_A + (*text - 'a'));
+                    break;
+            }
+        }
+    }
+};
+
+// Test that the automaton finds the same corrections as walking the trie, over a long random corpus
+TEST_F(AutoCorrectCorpus, MatchesTrieReference) {
+    TestDriver driver;
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+
+    static const char *fragments[] = {
+        "fales", "ouput", "ouptut", "the the ", "thier", "ture ", "looses ", "guage", "accomodate", "aparrent", "apparant", "namespcae", "retun", "reutrn", "swtich", "widht", "heigth", "the", "their", "true", "loose", "output", "false", "namespace", "return", "ou", "apar", "accom", " ", " ", "'", "\b", "\b\b", "\n",
+    };
+    std::mt19937         rng(42);
+    std::vector<uint8_t> keys;
+    for (int i = 0; i < 20000; ++i) {
+        if (rng() % 3 == 0) {
+            keys.push_back(KC_A + rng() % 26);
+        } else {
+            append(keys, fragments[rng() % (sizeof(fragments) / sizeof(fragments[0]))]);
+        }
+        if (rng() % 97 == 0) {
+            keys.push_back(KC_1 + rng() % 10);
+        }
+        if (rng() % 211 == 0) {
+            keys.push_back(KC_ESCAPE);
+        }
+    }
+
+    TrieReference reference;
+    for (uint8_t keycode : keys) {
+        reference.process(keycode);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint8_t keycode : keys) {
+        tap(keycode);
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    std::cout << "Autocorrect: " << keys.size() << " keys, " << applied.size() << " corrections in " << elapsed.count() << "us" << std::endl;
+
+    EXPECT_GT(reference.corrections.size(), 1000u);
+    ASSERT_EQ(applied.size(), reference.corrections.size());
+    for (size_t i = 0; i < applied.size(); ++i) {
+        EXPECT_EQ(applied[i], reference.corrections[i]) << "correction " << i;
+    }
+    VERIFY_AND_CLEAR(driver);
+}
+
+// Test that editing the buffer with backspace keeps the automaton in step with it
+TEST_F(AutoCorrectCorpus, BackspaceResumesMatch) {
+    TestDriver driver;
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+
+    std::vector<uint8_t> keys;
+    append(keys, " fax\bles ouq\bput ou\b\bouput");
+    for (uint8_t keycode : keys) {
+        tap(keycode);
+    }
+
+    ASSERT_EQ(applied.size(), 3u);
+    EXPECT_EQ(applied[0].correct, "false");
+    EXPECT_EQ(applied[1].correct, "output");
+    EXPECT_EQ(applied[2].correct, "output");
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,78 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::InSequence;
+
+class MatrixScan : public TestFixture {};
+
+TEST_F(MatrixScan, ChangeInLastRowIsReported) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, MATRIX_COLS - 1, MATRIX_ROWS - 1, KC_A);
+
+    set_keymap({key});
+
+    InSequence s;
+    EXPECT_REPORT(driver, (KC_A));
+    key.press();
+    keyboard_task();
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    keyboard_task();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixScan, PressAndReleaseInOneScanAreReportedInRowOrder) {
+    TestDriver driver;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b = KeymapKey(0, 2, 3, KC_B);
+
+    set_keymap({key_a, key_b});
+
+    InSequence s;
+    EXPECT_REPORT(driver, (KC_B));
+    key_b.press();
+    keyboard_task();
+
+    EXPECT_REPORT(driver, (KC_B, KC_A));
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    key_b.release();
+    keyboard_task();
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    keyboard_task();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixScan, EachRowIsReadOncePerScan) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 5, 2, KC_A);
+
+    set_keymap({key});
+
+    InSequence s;
+    uint32_t   reads = matrix_row_reads();
+    keyboard_task();
+    EXPECT_EQ(matrix_row_reads() - reads, MATRIX_ROWS) << "Scan without changes";
+
+    // A change is processed in the same pass that finds it
+    EXPECT_REPORT(driver, (KC_A));
+    reads = matrix_row_reads();
+    key.press();
+    keyboard_task();
+    EXPECT_EQ(matrix_row_reads() - reads, MATRIX_ROWS) << "Scan with a change";
+
+    reads = matrix_row_reads();
+    keyboard_task();
+    EXPECT_EQ(matrix_row_reads() - reads, MATRIX_ROWS) << "Scan with a key held";
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    keyboard_task();
+    VERIFY_AND_CLEAR(driver);
+}
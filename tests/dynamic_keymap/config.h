@@ -0,0 +1,11 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define DYNAMIC_KEYMAP_RAM_SHADOW
+#define DYNAMIC_KEYMAP_RAM_SHADOW_WRITE_DELAY 100
+#define DYNAMIC_KEYMAP_LAYER_COUNT 2
+#define TRANSIENT_EEPROM_SIZE 512
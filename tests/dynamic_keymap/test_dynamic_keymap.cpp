@@ -0,0 +1,94 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "dynamic_keymap.h"
+#include "keymap_introspection.h"
+#include "eeprom.h"
+}
+
+using testing::_;
+
+class DynamicKeymapShadow : public TestFixture {
+   protected:
+    void SetUp() override {
+        dynamic_keymap_shadow_invalidate();
+        dynamic_keymap_reset();
+    }
+};
+
+// Reads the keycode the way the keymap did before the RAM shadow existed
+static uint16_t eeprom_keycode(uint8_t layer, uint8_t row, uint8_t column) {
+    uint8_t *address = (uint8_t *)dynamic_keymap_key_to_eeprom_address(layer, row, column);
+    return (eeprom_read_byte(address) << 8) | eeprom_read_byte(address + 1);
+}
+
+static void expect_lookups_match_eeprom(void) {
+    for (uint8_t layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t column = 0; column < MATRIX_COLS; column++) {
+                EXPECT_EQ(dynamic_keymap_get_keycode(layer, row, column), eeprom_keycode(layer, row, column)) << "layer " << +layer << " row " << +row << " column " << +column;
+            }
+        }
+    }
+}
+
+TEST_F(DynamicKeymapShadow, ResetMatchesEeprom) {
+    expect_lookups_match_eeprom();
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 0), keycode_at_keymap_location_raw(0, 0, 0));
+}
+
+TEST_F(DynamicKeymapShadow, WritesAreDeferred) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    uint16_t original = eeprom_keycode(1, 2, 3);
+
+    dynamic_keymap_set_keycode(1, 2, 3, LCTL(KC_X));
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 2, 3), LCTL(KC_X));
+    EXPECT_EQ(eeprom_keycode(1, 2, 3), original);
+
+    idle_for(DYNAMIC_KEYMAP_RAM_SHADOW_WRITE_DELAY / 2);
+    EXPECT_EQ(eeprom_keycode(1, 2, 3), original);
+
+    idle_for(DYNAMIC_KEYMAP_RAM_SHADOW_WRITE_DELAY);
+    EXPECT_EQ(eeprom_keycode(1, 2, 3), LCTL(KC_X));
+    expect_lookups_match_eeprom();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DynamicKeymapShadow, BufferWritesStayCoherent) {
+    uint8_t data[14];
+    for (uint8_t i = 0; i < sizeof(data); i++) {
+        data[i] = 0x40 + i;
+    }
+    // Straddle the end of the keymap so the out of range part is dropped
+    uint16_t size   = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
+    uint16_t offset = size - 8;
+    dynamic_keymap_set_buffer(offset, sizeof(data), data);
+
+    uint8_t readback[sizeof(data)];
+    dynamic_keymap_get_buffer(offset, sizeof(readback), readback);
+    EXPECT_EQ(memcmp(readback, data, 8), 0);
+    for (uint8_t i = 8; i < sizeof(readback); i++) {
+        EXPECT_EQ(readback[i], 0);
+    }
+    EXPECT_EQ(dynamic_keymap_get_keycode(DYNAMIC_KEYMAP_LAYER_COUNT - 1, MATRIX_ROWS - 1, MATRIX_COLS - 1), 0x4647);
+
+    dynamic_keymap_flush();
+    expect_lookups_match_eeprom();
+}
+
+TEST_F(DynamicKeymapShadow, InvalidateReloadsFromEeprom) {
+    uint8_t *address = (uint8_t *)dynamic_keymap_key_to_eeprom_address(0, 1, 1);
+    eeprom_update_byte(address, 0x12);
+    eeprom_update_byte(address + 1, 0x34);
+    EXPECT_NE(dynamic_keymap_get_keycode(0, 1, 1), 0x1234);
+
+    dynamic_keymap_shadow_invalidate();
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 1, 1), 0x1234);
+    expect_lookups_match_eeprom();
+}
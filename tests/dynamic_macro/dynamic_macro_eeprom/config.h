@@ -0,0 +1,11 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define DYNAMIC_MACRO_EEPROM_STORAGE
+#define DYNAMIC_MACRO_RECORDED_TIMING
+#define DYNAMIC_MACRO_BUFFER_SIZE 256
+#define TRANSIENT_EEPROM_SIZE 512
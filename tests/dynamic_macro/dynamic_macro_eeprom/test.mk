@@ -0,0 +1,5 @@
+# Copyright 2025 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+DYNAMIC_MACRO_ENABLE = yes
+EEPROM_DRIVER = transient
@@ -0,0 +1,49 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycodes.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "process_dynamic_macro.h"
+}
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InSequence;
+
+class DynamicMacroEeprom : public TestFixture {};
+
+TEST_F(DynamicMacroEeprom, MacrosSurviveReinit) {
+    TestDriver driver;
+    KeymapKey  key_rec1  = KeymapKey(0, 0, 0, DM_REC1);
+    KeymapKey  key_rec2  = KeymapKey(0, 1, 0, DM_REC2);
+    KeymapKey  key_stop  = KeymapKey(0, 2, 0, DM_RSTP);
+    KeymapKey  key_play1 = KeymapKey(0, 3, 0, DM_PLY1);
+    KeymapKey  key_play2 = KeymapKey(0, 4, 0, DM_PLY2);
+    KeymapKey  key_a     = KeymapKey(0, 5, 0, KC_A);
+    KeymapKey  key_b     = KeymapKey(0, 6, 0, KC_B);
+
+    set_keymap({key_rec1, key_rec2, key_stop, key_play1, key_play2, key_a, key_b});
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    tap_keys(key_rec1, key_a, key_stop);
+    tap_keys(key_rec2, key_b, key_stop);
+    VERIFY_AND_CLEAR(driver);
+
+    // Simulate a power cycle
+    dynamic_macro_init();
+
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_A));
+        EXPECT_EMPTY_REPORT(driver);
+        EXPECT_REPORT(driver, (KC_B));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    tap_key(key_play1);
+    idle_for(10);
+    tap_key(key_play2);
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,227 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycodes.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "process_dynamic_macro.h"
+}
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InSequence;
+
+class DynamicMacro : public TestFixture {
+   protected:
+    void SetUp() override {
+        dynamic_macro_init();
+        dynamic_macro_set_recorded_timing(false);
+    }
+};
+
+TEST_F(DynamicMacro, RecordAndPlay) {
+    TestDriver driver;
+    KeymapKey  key_rec  = KeymapKey(0, 0, 0, DM_REC1);
+    KeymapKey  key_stop = KeymapKey(0, 1, 0, DM_RSTP);
+    KeymapKey  key_play = KeymapKey(0, 2, 0, DM_PLY1);
+    KeymapKey  key_a    = KeymapKey(0, 3, 0, KC_A);
+    KeymapKey  key_b    = KeymapKey(0, 4, 0, KC_B);
+
+    set_keymap({key_rec, key_stop, key_play, key_a, key_b});
+
+    EXPECT_REPORT(driver, (KC_A)).Times(1);
+    EXPECT_REPORT(driver, (KC_B)).Times(1);
+    EXPECT_EMPTY_REPORT(driver).Times(AnyNumber());
+    tap_keys(key_rec, key_a, key_b, key_stop);
+    VERIFY_AND_CLEAR(driver);
+
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_A));
+        EXPECT_EMPTY_REPORT(driver);
+        EXPECT_REPORT(driver, (KC_B));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    tap_key(key_play);
+    EXPECT_TRUE(dynamic_macro_is_playing());
+    idle_for(10);
+    EXPECT_FALSE(dynamic_macro_is_playing());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DynamicMacro, BothSlotsShareBuffer) {
+    TestDriver driver;
+    KeymapKey  key_rec1  = KeymapKey(0, 0, 0, DM_REC1);
+    KeymapKey  key_rec2  = KeymapKey(0, 1, 0, DM_REC2);
+    KeymapKey  key_stop  = KeymapKey(0, 2, 0, DM_RSTP);
+    KeymapKey  key_play1 = KeymapKey(0, 3, 0, DM_PLY1);
+    KeymapKey  key_play2 = KeymapKey(0, 4, 0, DM_PLY2);
+    KeymapKey  key_a     = KeymapKey(0, 5, 0, KC_A);
+    KeymapKey  key_b     = KeymapKey(0, 6, 0, KC_B);
+
+    set_keymap({key_rec1, key_rec2, key_stop, key_play1, key_play2, key_a, key_b});
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    tap_keys(key_rec1, key_a, key_stop);
+    tap_keys(key_rec2, key_b, key_b, key_stop);
+    VERIFY_AND_CLEAR(driver);
+
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_B));
+        EXPECT_EMPTY_REPORT(driver);
+        EXPECT_REPORT(driver, (KC_B));
+        EXPECT_EMPTY_REPORT(driver);
+        EXPECT_REPORT(driver, (KC_A));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    tap_key(key_play2);
+    idle_for(10);
+    tap_key(key_play1);
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DynamicMacro, PackedEventsFitBuffer) {
+    TestDriver driver;
+    KeymapKey  key_rec  = KeymapKey(0, 0, 0, DM_REC1);
+    KeymapKey  key_stop = KeymapKey(0, 1, 0, DM_RSTP);
+    KeymapKey  key_play = KeymapKey(0, 2, 0, DM_PLY1);
+    KeymapKey  key_a    = KeymapKey(0, 3, 0, KC_A);
+
+    set_keymap({key_rec, key_stop, key_play, key_a});
+
+    // Plain key events with short gaps pack into two bytes, so a 32 byte
+    // buffer holds 8 taps and drops the rest.
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    tap_key(key_rec);
+    for (int i = 0; i < 10; i++) {
+        tap_key(key_a);
+    }
+    tap_key(key_stop);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A)).Times(8);
+    EXPECT_EMPTY_REPORT(driver).Times(8);
+    tap_key(key_play);
+    idle_for(40);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DynamicMacro, TrailingKeyDownIsTrimmed) {
+    TestDriver driver;
+    KeymapKey  key_rec  = KeymapKey(0, 0, 0, DM_REC1);
+    KeymapKey  key_stop = KeymapKey(0, 1, 0, DM_RSTP);
+    KeymapKey  key_play = KeymapKey(0, 2, 0, DM_PLY1);
+    KeymapKey  key_a    = KeymapKey(0, 3, 0, KC_A);
+    KeymapKey  key_b    = KeymapKey(0, 4, 0, KC_B);
+
+    set_keymap({key_rec, key_stop, key_play, key_a, key_b});
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    tap_keys(key_rec, key_a);
+    key_b.press();
+    run_one_scan_loop();
+    tap_key(key_stop);
+    key_b.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_A));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    tap_key(key_play);
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DynamicMacro, RecordedTiming) {
+    TestDriver driver;
+    KeymapKey  key_rec  = KeymapKey(0, 0, 0, DM_REC1);
+    KeymapKey  key_stop = KeymapKey(0, 1, 0, DM_RSTP);
+    KeymapKey  key_play = KeymapKey(0, 2, 0, DM_PLY1);
+    KeymapKey  key_a    = KeymapKey(0, 3, 0, KC_A);
+
+    set_keymap({key_rec, key_stop, key_play, key_a});
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    tap_key(key_rec);
+    tap_key(key_a, 200);
+    tap_key(key_stop);
+    VERIFY_AND_CLEAR(driver);
+
+    dynamic_macro_set_recorded_timing(true);
+
+    EXPECT_REPORT(driver, (KC_A));
+    tap_key(key_play);
+    idle_for(150);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(100);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DynamicMacro, MacroCannotReplayItself) {
+    TestDriver driver;
+    KeymapKey  key_rec  = KeymapKey(0, 0, 0, DM_REC1);
+    KeymapKey  key_stop = KeymapKey(0, 1, 0, DM_RSTP);
+    KeymapKey  key_play = KeymapKey(0, 2, 0, DM_PLY1);
+    KeymapKey  key_a    = KeymapKey(0, 3, 0, KC_A);
+
+    set_keymap({key_rec, key_stop, key_play, key_a});
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    tap_keys(key_rec, key_a, key_play, key_stop);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A)).Times(1);
+    EXPECT_EMPTY_REPORT(driver).Times(1);
+    tap_key(key_play);
+    idle_for(20);
+    EXPECT_FALSE(dynamic_macro_is_playing());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DynamicMacro, HeldKeyIsDeferredUntilReleased) {
+    TestDriver driver;
+    KeymapKey  key_rec  = KeymapKey(0, 0, 0, DM_REC1);
+    KeymapKey  key_stop = KeymapKey(0, 1, 0, DM_RSTP);
+    KeymapKey  key_play = KeymapKey(0, 2, 0, DM_PLY1);
+    KeymapKey  key_a    = KeymapKey(0, 3, 0, KC_A);
+    KeymapKey  key_b    = KeymapKey(0, 4, 0, KC_B);
+
+    set_keymap({key_rec, key_stop, key_play, key_a, key_b});
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    tap_keys(key_rec, key_a, key_b, key_stop);
+    key_b.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // The macro must not press or release B underneath the held key
+    {
+        InSequence s;
+        EXPECT_EMPTY_REPORT(driver);
+        EXPECT_REPORT(driver, (KC_A));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    tap_key(key_play);
+    idle_for(20);
+    EXPECT_TRUE(dynamic_macro_is_playing());
+    VERIFY_AND_CLEAR(driver);
+
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_B));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    key_b.release();
+    run_one_scan_loop();
+    idle_for(10);
+    EXPECT_FALSE(dynamic_macro_is_playing());
+    VERIFY_AND_CLEAR(driver);
+}
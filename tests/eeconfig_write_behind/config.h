@@ -0,0 +1,10 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define EECONFIG_WRITE_BEHIND
+#define EECONFIG_WRITE_BEHIND_DELAY 100
+#define TRANSIENT_EEPROM_SIZE 64
@@ -0,0 +1,113 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "eeconfig.h"
+#include "eeprom.h"
+
+static bool handedness_is_critical = false;
+
+bool eeconfig_write_behind_may_defer_user(uintptr_t addr, size_t len) {
+    return !(handedness_is_critical && addr == (uintptr_t)EECONFIG_HANDEDNESS);
+}
+}
+
+using testing::_;
+
+class EeconfigWriteBehind : public TestFixture {
+   protected:
+    void SetUp() override {
+        handedness_is_critical = false;
+        eeconfig_update_keymap(0x1400);
+        eeconfig_update_debug(0);
+        eeconfig_update_handedness(false);
+        eeconfig_write_behind_flush();
+    }
+};
+
+TEST_F(EeconfigWriteBehind, UpdatesAreDeferred) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    eeconfig_update_keymap(0x1234);
+    EXPECT_EQ(eeconfig_read_keymap(), 0x1234);
+    EXPECT_EQ(eeprom_read_word(EECONFIG_KEYMAP), 0x1400);
+
+    idle_for(EECONFIG_WRITE_BEHIND_DELAY / 2);
+    EXPECT_EQ(eeprom_read_word(EECONFIG_KEYMAP), 0x1400);
+
+    idle_for(EECONFIG_WRITE_BEHIND_DELAY);
+    EXPECT_EQ(eeprom_read_word(EECONFIG_KEYMAP), 0x1234);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(EeconfigWriteBehind, RepeatedUpdatesKeepDeferring) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    for (uint8_t i = 1; i <= 5; i++) {
+        eeconfig_update_debug(i);
+        idle_for(EECONFIG_WRITE_BEHIND_DELAY / 2);
+        EXPECT_EQ(eeprom_read_byte(EECONFIG_DEBUG), 0);
+        EXPECT_EQ(eeconfig_read_debug(), i);
+    }
+
+    idle_for(EECONFIG_WRITE_BEHIND_DELAY);
+    EXPECT_EQ(eeprom_read_byte(EECONFIG_DEBUG), 5);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(EeconfigWriteBehind, ExplicitFlush) {
+    eeconfig_update_debug(0x0F);
+    eeconfig_update_keymap(0x4321);
+    EXPECT_EQ(eeprom_read_byte(EECONFIG_DEBUG), 0);
+
+    eeconfig_write_behind_flush();
+    EXPECT_EQ(eeprom_read_byte(EECONFIG_DEBUG), 0x0F);
+    EXPECT_EQ(eeprom_read_word(EECONFIG_KEYMAP), 0x4321);
+}
+
+TEST_F(EeconfigWriteBehind, MagicIsWrittenAfterPendingData) {
+    eeconfig_update_keymap(0x5555);
+    EXPECT_EQ(eeprom_read_word(EECONFIG_KEYMAP), 0x1400);
+
+    eeconfig_disable();
+    EXPECT_TRUE(eeconfig_is_disabled());
+    EXPECT_EQ(eeprom_read_word(EECONFIG_MAGIC), EECONFIG_MAGIC_NUMBER_OFF);
+
+    eeconfig_update_keymap(0x6666);
+    eeconfig_enable();
+    EXPECT_EQ(eeprom_read_word(EECONFIG_MAGIC), EECONFIG_MAGIC_NUMBER);
+    EXPECT_EQ(eeprom_read_word(EECONFIG_KEYMAP), 0x6666);
+}
+
+TEST_F(EeconfigWriteBehind, DisableFlushesPendingWrites) {
+    eeconfig_update_keymap(0x7777);
+    eeconfig_update_debug(0x05);
+    EXPECT_EQ(eeprom_read_word(EECONFIG_KEYMAP), 0x1400);
+
+    eeconfig_disable();
+    EXPECT_EQ(eeprom_read_word(EECONFIG_KEYMAP), 0x7777);
+    EXPECT_EQ(eeprom_read_byte(EECONFIG_DEBUG), 0x05);
+    EXPECT_EQ(eeconfig_read_keymap(), 0x7777);
+    EXPECT_EQ(eeprom_read_word(EECONFIG_MAGIC), EECONFIG_MAGIC_NUMBER_OFF);
+}
+
+TEST_F(EeconfigWriteBehind, PolicyCanForceWriteThrough) {
+    eeconfig_update_debug(0x03);
+    handedness_is_critical = true;
+    eeconfig_update_handedness(true);
+
+    EXPECT_TRUE(eeprom_read_byte(EECONFIG_HANDEDNESS));
+    EXPECT_EQ(eeprom_read_byte(EECONFIG_DEBUG), 0x03);
+}
+
+TEST_F(EeconfigWriteBehind, ReadsSeeDataWrittenBeforeCaching) {
+    eeprom_update_word(EECONFIG_KEYMAP, 0x0042);
+    eeconfig_write_behind_invalidate();
+    EXPECT_EQ(eeconfig_read_keymap(), 0x0042);
+}
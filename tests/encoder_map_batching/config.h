@@ -0,0 +1,10 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define NUM_ENCODERS 3
+#define MAX_QUEUED_ENCODER_EVENTS 16
+#define ENCODER_MAP_BATCHING
@@ -0,0 +1,10 @@
+# Copyright 2025 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+ENCODER_ENABLE = yes
+ENCODER_DRIVER = custom
+ENCODER_MAP_ENABLE = yes
+MOUSEKEY_ENABLE = yes
+EXTRAKEY_ENABLE = yes
+
+INTROSPECTION_KEYMAP_C = test_encoder_map.c
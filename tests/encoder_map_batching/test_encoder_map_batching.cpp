@@ -0,0 +1,126 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "keyboard_report_util.hpp"
+#include "mouse_report_util.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+#include "encoder.h"
+
+void encoder_driver_init(void) {}
+void encoder_driver_task(void) {}
+}
+
+using testing::_;
+using testing::Field;
+using testing::InSequence;
+
+class EncoderMapBatching : public TestFixture {};
+
+static void queue_detents(uint8_t index, bool clockwise, uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        encoder_queue_event(index, clockwise);
+    }
+}
+
+TEST_F(EncoderMapBatching, WheelDetentsShareOneReport) {
+    TestDriver driver;
+
+    queue_detents(0, true, 3);
+    EXPECT_MOUSE_REPORT(driver, (0, 0, 0, -3, 0)).Times(1);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    queue_detents(0, false, 2);
+    EXPECT_MOUSE_REPORT(driver, (0, 0, 0, 2, 0)).Times(1);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(EncoderMapBatching, DirectionChangeSplitsBatch) {
+    TestDriver driver;
+    InSequence s;
+
+    queue_detents(0, true, 2);
+    queue_detents(0, false, 1);
+    queue_detents(0, true, 1);
+    EXPECT_MOUSE_REPORT(driver, (0, 0, 0, -2, 0));
+    EXPECT_MOUSE_REPORT(driver, (0, 0, 0, 1, 0));
+    EXPECT_MOUSE_REPORT(driver, (0, 0, 0, -1, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(EncoderMapBatching, ConsumerDetentsAreTapped) {
+    TestDriver driver;
+
+    queue_detents(1, true, 4);
+    EXPECT_CALL(driver, send_extra_mock(_)).Times(8);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(EncoderMapBatching, OtherKeycodesKeepPerDetentTaps) {
+    TestDriver driver;
+    InSequence s;
+
+    queue_detents(2, true, 2);
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(EncoderMapBatching, WheelBatchKeepsHeldButtons) {
+    TestDriver driver;
+    KeymapKey  key_btn = KeymapKey(0, 0, 0, MS_BTN1);
+
+    set_keymap({key_btn});
+
+    EXPECT_MOUSE_REPORT(driver, (0, 0, 0, 0, 1));
+    key_btn.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    queue_detents(0, true, 3);
+    EXPECT_MOUSE_REPORT(driver, (0, 0, 0, -3, 1)).Times(1);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_MOUSE_REPORT(driver, (0, 0, 0, 0, 0));
+    key_btn.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(EncoderMapBatching, ConsumerBatchRestoresHeldUsage) {
+    TestDriver driver;
+    KeymapKey  key_play = KeymapKey(0, 0, 0, KC_MPLY);
+
+    set_keymap({key_play});
+
+    EXPECT_CALL(driver, send_extra_mock(Field(&report_extra_t::usage, TRANSPORT_PLAY_PAUSE)));
+    key_play.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    {
+        InSequence s;
+        EXPECT_CALL(driver, send_extra_mock(Field(&report_extra_t::usage, AUDIO_VOL_UP)));
+        EXPECT_CALL(driver, send_extra_mock(Field(&report_extra_t::usage, TRANSPORT_PLAY_PAUSE)));
+        EXPECT_CALL(driver, send_extra_mock(Field(&report_extra_t::usage, AUDIO_VOL_UP)));
+        EXPECT_CALL(driver, send_extra_mock(Field(&report_extra_t::usage, TRANSPORT_PLAY_PAUSE)));
+    }
+    queue_detents(1, true, 2);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_CALL(driver, send_extra_mock(Field(&report_extra_t::usage, 0)));
+    key_play.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,13 @@
+# Copyright 2025 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# --------------------------------------------------------------------------------
+# Keep this file, even if it is empty, as a marker that this folder contains tests
+# --------------------------------------------------------------------------------
+
+include $(TEST_PATH)/../test.mk
+
+# Runs the same tests with too small an index, so that every override is scanned
+SRC += ../test_key_override.cpp
+
+INTROSPECTION_KEYMAP_C = ../test_key_overrides.c
@@ -0,0 +1,261 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InSequence;
+
+extern "C" bool alt_override_enabled;
+
+class KeyOverride : public TestFixture {
+   public:
+    void SetUp() override {
+        alt_override_enabled = true;
+        key_override_on();
+    }
+};
+
+TEST_F(KeyOverride, ShiftBackspaceSendsDelete) {
+    TestDriver driver;
+    KeymapKey  key_shift(0, 0, 0, KC_LSFT);
+    KeymapKey  key_bspc(0, 1, 0, KC_BSPC);
+    set_keymap({key_shift, key_bspc});
+
+    InSequence s;
+    EXPECT_REPORT(driver, (KC_LSFT));
+    key_shift.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_DEL));
+    key_bspc.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    key_bspc.release();
+    run_one_scan_loop();
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, TriggerWithoutModsIsSent) {
+    TestDriver driver;
+    KeymapKey  key_bspc(0, 1, 0, KC_BSPC);
+    set_keymap({key_bspc});
+
+    InSequence s;
+    EXPECT_REPORT(driver, (KC_BSPC));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_bspc);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, LastOverrideInTriggerOrderActivates) {
+    TestDriver driver;
+    KeymapKey  key_shift(0, 0, 0, KC_LSFT);
+    KeymapKey  key_slash(0, 1, 0, KC_SLSH);
+    set_keymap({key_shift, key_slash});
+
+    InSequence s;
+    EXPECT_REPORT(driver, (KC_LSFT));
+    key_shift.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_BSLS));
+    EXPECT_REPORT(driver, (KC_LSFT));
+    tap_key(key_slash);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, FirstMatchingOverrideWins) {
+    TestDriver driver;
+    KeymapKey  key_shift(0, 0, 0, KC_LSFT);
+    KeymapKey  key_a(0, 1, 0, KC_A);
+    KeymapKey  key_shift_layer_one(1, 0, 0, KC_LSFT);
+    KeymapKey  key_a_layer_one(1, 1, 0, KC_A);
+    set_keymap({key_shift, key_a, key_shift_layer_one, key_a_layer_one});
+
+    // The layer one override comes first, but does not apply to layer zero
+    InSequence s;
+    EXPECT_REPORT(driver, (KC_LSFT));
+    key_shift.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_C));
+    EXPECT_REPORT(driver, (KC_LSFT));
+    tap_key(key_a);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    layer_on(1);
+    EXPECT_REPORT(driver, (KC_LSFT));
+    key_shift_layer_one.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_REPORT(driver, (KC_LSFT));
+    tap_key(key_a_layer_one);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_shift_layer_one.release();
+    run_one_scan_loop();
+    layer_off(1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, ModifierActivatesOverrideForLastKey) {
+    TestDriver driver;
+    KeymapKey  key_shift(0, 0, 0, KC_LSFT);
+    KeymapKey  key_a(0, 1, 0, KC_A);
+    set_keymap({key_shift, key_a});
+
+    InSequence s;
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // The replacement is deferred until the key repeat delay has passed since the trigger was pressed
+    EXPECT_EMPTY_REPORT(driver).Times(AnyNumber());
+    key_shift.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_C));
+    idle_for(500);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver).Times(AnyNumber());
+    EXPECT_REPORT(driver, (KC_LSFT));
+    key_a.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, OverrideWithoutTriggerActivatesOnMods) {
+    TestDriver driver;
+    KeymapKey  key_ctrl(0, 0, 0, KC_LCTL);
+    KeymapKey  key_alt(0, 1, 0, KC_LALT);
+    set_keymap({key_ctrl, key_alt});
+
+    InSequence s;
+    EXPECT_REPORT(driver, (KC_LCTL));
+    key_ctrl.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // Both mods are suppressed while the override is active
+    EXPECT_EMPTY_REPORT(driver).Times(AnyNumber());
+    key_alt.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_ESC));
+    idle_for(500);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LCTL, KC_LALT));
+    EXPECT_REPORT(driver, (KC_LCTL));
+    EXPECT_EMPTY_REPORT(driver);
+    key_alt.release();
+    run_one_scan_loop();
+    key_ctrl.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, DisabledOverrideIsSkipped) {
+    TestDriver driver;
+    KeymapKey  key_alt(0, 0, 0, KC_LALT);
+    KeymapKey  key_d(0, 1, 0, KC_D);
+    set_keymap({key_alt, key_d});
+
+    InSequence s;
+    EXPECT_REPORT(driver, (KC_LALT));
+    key_alt.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_E));
+    EXPECT_REPORT(driver, (KC_LALT));
+    tap_key(key_d);
+    VERIFY_AND_CLEAR(driver);
+
+    alt_override_enabled = false;
+    EXPECT_REPORT(driver, (KC_LALT, KC_D));
+    EXPECT_REPORT(driver, (KC_LALT));
+    tap_key(key_d);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_alt.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, NegativeModBlocksOverride) {
+    TestDriver driver;
+    KeymapKey  key_shift(0, 0, 0, KC_LSFT);
+    KeymapKey  key_ctrl(0, 1, 0, KC_LCTL);
+    KeymapKey  key_d(0, 2, 0, KC_D);
+    set_keymap({key_shift, key_ctrl, key_d});
+
+    InSequence s;
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_REPORT(driver, (KC_LSFT, KC_LCTL));
+    key_shift.press();
+    run_one_scan_loop();
+    key_ctrl.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_LSFT, KC_LCTL, KC_D));
+    EXPECT_REPORT(driver, (KC_LSFT, KC_LCTL));
+    tap_key(key_d);
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_EMPTY_REPORT(driver);
+    key_ctrl.release();
+    run_one_scan_loop();
+    key_shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, ToggleOffSendsTrigger) {
+    TestDriver driver;
+    KeymapKey  key_shift(0, 0, 0, KC_LSFT);
+    KeymapKey  key_bspc(0, 1, 0, KC_BSPC);
+    set_keymap({key_shift, key_bspc});
+
+    key_override_off();
+
+    InSequence s;
+    EXPECT_REPORT(driver, (KC_LSFT));
+    key_shift.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_LSFT, KC_BSPC));
+    EXPECT_REPORT(driver, (KC_LSFT));
+    tap_key(key_bspc);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
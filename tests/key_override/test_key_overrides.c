@@ -0,0 +1,26 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+bool alt_override_enabled = true;
+
+// Declared out of trigger order, so that lookups have to use the index
+const key_override_t shift_slash_override  = ko_make_basic(MOD_MASK_SHIFT, KC_SLSH, KC_BSLS);
+const key_override_t layer_one_a_override  = ko_make_with_layers(MOD_MASK_SHIFT, KC_A, KC_B, 1 << 1);
+const key_override_t shift_a_override      = ko_make_basic(MOD_MASK_SHIFT, KC_A, KC_C);
+const key_override_t shift_bspc_override   = ko_make_basic(MOD_MASK_SHIFT, KC_BSPC, KC_DEL);
+const key_override_t ctrl_alt_override     = ko_make_basic(MOD_MASK_CA, KC_NO, KC_ESC);
+const key_override_t alt_d_override        = {.trigger = KC_D, .trigger_mods = MOD_BIT(KC_LALT), .layers = ~0, .suppressed_mods = MOD_BIT(KC_LALT), .replacement = KC_E, .options = ko_options_default, .enabled = &alt_override_enabled};
+const key_override_t shift_d_no_ctrl       = ko_make_with_layers_and_negmods(MOD_MASK_SHIFT, KC_D, KC_F, ~0, MOD_MASK_CTRL);
+
+// clang-format off
+const key_override_t *key_overrides[] = {
+    &shift_slash_override,
+    &layer_one_a_override,
+    &shift_a_override,
+    &shift_bspc_override,
+    &ctrl_alt_override,
+    &alt_d_override,
+    &shift_d_no_ctrl,
+};
+// clang-format on
@@ -0,0 +1,106 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class LayerLookup : public TestFixture {
+   public:
+    uint32_t lookups_since(uint32_t start) {
+        return get_layer_lookup_count() - start;
+    }
+};
+
+TEST_F(LayerLookup, PressIsLookedUpOnce) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    set_keymap({key_a});
+
+    InSequence s;
+    EXPECT_REPORT(driver, (KC_A));
+    uint32_t start = get_layer_lookup_count();
+    key_a.press();
+    run_one_scan_loop();
+    EXPECT_EQ(lookups_since(start), 1u);
+
+    // Releases use the layer the key was pressed on
+    EXPECT_EMPTY_REPORT(driver);
+    start = get_layer_lookup_count();
+    key_a.release();
+    run_one_scan_loop();
+    EXPECT_EQ(lookups_since(start), 0u);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerLookup, TapHoldPressIsLookedUpOnce) {
+    TestDriver driver;
+    KeymapKey  key_mt(0, 0, 0, SFT_T(KC_A));
+    set_keymap({key_mt});
+
+    InSequence s;
+    EXPECT_NO_REPORT(driver);
+    uint32_t start = get_layer_lookup_count();
+    key_mt.press();
+    run_one_scan_loop();
+    EXPECT_EQ(lookups_since(start), 1u);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    key_mt.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerLookup, LayerChangeIsLookedUpAgain) {
+    TestDriver driver;
+    KeymapKey  key_mo(0, 0, 0, MO(1));
+    KeymapKey  key_a(0, 1, 0, KC_A);
+    KeymapKey  key_b(1, 1, 0, KC_B);
+    set_keymap({key_mo, key_a, key_b});
+
+    InSequence s;
+    EXPECT_NO_REPORT(driver);
+    key_mo.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_b);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    key_mo.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerLookup, KeymapChangeIsLookedUpAgain) {
+    TestDriver  driver;
+    KeymapKey   key_a(0, 0, 0, KC_A);
+    keyrecord_t record   = {};
+    record.event.type    = KEY_EVENT;
+    record.event.pressed = true;
+    record.event.time    = 1;
+    set_keymap({key_a});
+
+    EXPECT_EQ(layer_switch_get_record_keycode(&record), KC_A);
+    uint32_t start = get_layer_lookup_count();
+    EXPECT_EQ(layer_switch_get_record_keycode(&record), KC_A);
+    EXPECT_EQ(lookups_since(start), 0u);
+
+    set_keymap({KeymapKey(0, 0, 0, KC_B)});
+    layer_switch_invalidate();
+    EXPECT_EQ(layer_switch_get_record_keycode(&record), KC_B);
+    EXPECT_EQ(lookups_since(start), 1u);
+}
@@ -0,0 +1,45 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*******************************************************************************
+  88888888888 888      d8b                .d888 d8b 888               d8b
+      888     888      Y8P               d88P"  Y8P 888               Y8P
+      888     888                        888        888
+      888     88888b.  888 .d8888b       888888 888 888  .d88b.       888 .d8888b
+      888     888 "88b 888 88K           888    888 888 d8P  Y8b      888 88K
+      888     888  888 888 "Y8888b.      888    888 888 88888888      888 "Y8888b.
+      888     888  888 888      X88      888    888 888 Y8b.          888      X88
+      888     888  888 888  88888P'      888    888 888  "Y8888       888  88888P'
+                                                        888                 888
+                                                        888                 888
+                                                        888                 888
+     .d88b.   .d88b.  88888b.   .d88b.  888d888 8888b.  888888 .d88b.   .d88888
+    d88P"88b d8P  Y8b 888 "88b d8P  Y8b 888P"      "88b 888   d8P  Y8b d88" 888
+    888  888 88888888 888  888 88888888 888    .d888888 888   88888888 888  888
+    Y88b 888 Y8b.     888  888 Y8b.     888    888  888 Y88b. Y8b.     Y88b 888
+     "Y88888  "Y8888  888  888  "Y8888  888    "Y888888  "Y888 "Y8888   "Y88888
+         888
+    Y8b d88P
+     "Y88P"
+*******************************************************************************/
+
+#pragma once
+
+// Leader sequences (6 entries):
+//   KC_A                          -> KC_1
+//   KC_A KC_B                     -> KC_2
+//   KC_A KC_C                     -> LSFT(KC_3)
+//   KC_D                          -> KC_F20
+//   KC_G KC_I KC_T                -> QK_USER_0
+//   KC_X KC_Y KC_Z KC_X KC_Y KC_Z -> KC_6
+
+#define LEADER_DATA_MAX_LENGTH 6 // "KC_X KC_Y KC_Z KC_X KC_Y KC_Z"
+#define LEADER_DATA_SIZE 54
+
+static const uint16_t leader_data[LEADER_DATA_SIZE] PROGMEM = {
+    0x0008, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x000A, 0x001D, 0x001B, 0x0025, 0x0004, 0x0011, 0x0000,
+    0xFFFF, 0x0000, 0xFFFF, 0x0007, 0x001B, 0x8002, 0x001E, 0x0006, 0x0019, 0x0005, 0x0017, 0x8000,
+    0x001F, 0x8000, 0x0220, 0x8000, 0x006F, 0x0001, 0x000C, 0x0020, 0x0001, 0x0017, 0x0023, 0x8000,
+    0x7E40, 0x0001, 0x001C, 0x0028, 0x0001, 0x001D, 0x002B, 0x0001, 0x001B, 0x002E, 0x0001, 0x001C,
+    0x0031, 0x0001, 0x001D, 0x0034, 0x8000, 0x0023
+};
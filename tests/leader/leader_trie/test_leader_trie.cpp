@@ -0,0 +1,217 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+enum custom_keycodes {
+    MY_GIT_MACRO = SAFE_RANGE,
+};
+
+extern "C" bool process_leader_sequence_user(uint16_t result) {
+    switch (result) {
+        case KC_F20:
+            tap_code(KC_4);
+            return false;
+        case MY_GIT_MACRO:
+            tap_code(KC_5);
+            return false;
+    }
+    return true;
+}
+
+class LeaderTrie : public TestFixture {};
+
+TEST_F(LeaderTrie, unambiguous_sequence_fires_immediately) {
+    TestDriver driver;
+    InSequence s;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_a      = KeymapKey(0, 1, 0, KC_A);
+    auto key_b      = KeymapKey(0, 2, 0, KC_B);
+
+    set_keymap({key_leader, key_a, key_b});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_2));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_b);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(leader_sequence_active(), false);
+}
+
+TEST_F(LeaderTrie, prefix_sequence_fires_on_timeout) {
+    TestDriver driver;
+    InSequence s;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_a      = KeymapKey(0, 1, 0, KC_A);
+
+    set_keymap({key_leader, key_a});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(leader_sequence_active(), true);
+
+    EXPECT_REPORT(driver, (KC_1));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(300);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(leader_sequence_active(), false);
+}
+
+TEST_F(LeaderTrie, result_can_carry_modifiers) {
+    TestDriver driver;
+    InSequence s;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_a      = KeymapKey(0, 1, 0, KC_A);
+    auto key_c      = KeymapKey(0, 2, 0, KC_C);
+
+    set_keymap({key_leader, key_a, key_c});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_REPORT(driver, (KC_LSFT, KC_3));
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_c);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LeaderTrie, sequence_longer_than_five_keys) {
+    TestDriver driver;
+    InSequence s;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_x      = KeymapKey(0, 1, 0, KC_X);
+    auto key_y      = KeymapKey(0, 2, 0, KC_Y);
+    auto key_z      = KeymapKey(0, 3, 0, KC_Z);
+
+    set_keymap({key_leader, key_x, key_y, key_z});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_keys(key_x, key_y, key_z, key_x, key_y);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_6));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_z);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(leader_sequence_active(), false);
+}
+
+TEST_F(LeaderTrie, unknown_key_ends_sequence) {
+    TestDriver driver;
+    InSequence s;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_d      = KeymapKey(0, 1, 0, KC_D);
+    auto key_q      = KeymapKey(0, 2, 0, KC_Q);
+
+    set_keymap({key_leader, key_d, key_q});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_Q));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_q);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(leader_sequence_active(), false);
+}
+
+TEST_F(LeaderTrie, unknown_key_fires_pending_prefix) {
+    TestDriver driver;
+    InSequence s;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_a      = KeymapKey(0, 1, 0, KC_A);
+    auto key_q      = KeymapKey(0, 2, 0, KC_Q);
+
+    set_keymap({key_leader, key_a, key_q});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_1));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_Q));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_q);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(leader_sequence_active(), false);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LeaderTrie, custom_keycode_result) {
+    TestDriver driver;
+    InSequence s;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_g      = KeymapKey(0, 1, 0, KC_G);
+    auto key_i      = KeymapKey(0, 2, 0, KC_I);
+    auto key_t      = KeymapKey(0, 3, 0, KC_T);
+
+    set_keymap({key_leader, key_g, key_i, key_t});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_keys(key_g, key_i);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_5));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_t);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(leader_sequence_active(), false);
+}
+
+TEST_F(LeaderTrie, user_callback_handles_result) {
+    TestDriver driver;
+    InSequence s;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_d      = KeymapKey(0, 1, 0, KC_D);
+
+    set_keymap({key_leader, key_d});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_4));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_d);
+    VERIFY_AND_CLEAR(driver);
+}
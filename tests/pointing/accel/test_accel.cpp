@@ -0,0 +1,159 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "mouse_report_util.hpp"
+#include "test_common.hpp"
+#include "test_pointing_device_driver.h"
+
+extern "C" {
+#include "pointing_device.h"
+}
+
+using testing::_;
+
+class PointingAccel : public TestFixture {
+   protected:
+    void SetUp() override {
+        pointing_device_accel_reset();
+        pointing_device_accel_set_enabled(true);
+    }
+
+    void TearDown() override {
+        pd_clear_movement();
+        pointing_device_accel_reset();
+    }
+};
+
+TEST_F(PointingAccel, GainFollowsCurve) {
+    EXPECT_EQ(pointing_device_accel_get_gain(0), POINTING_DEVICE_ACCEL_GAIN(0.5));
+    EXPECT_EQ(pointing_device_accel_get_gain(10 * 256), POINTING_DEVICE_ACCEL_GAIN(0.5));
+    EXPECT_EQ(pointing_device_accel_get_gain(15 * 256), POINTING_DEVICE_ACCEL_GAIN(1.25));
+    EXPECT_EQ(pointing_device_accel_get_gain(20 * 256), POINTING_DEVICE_ACCEL_GAIN(2));
+    EXPECT_EQ(pointing_device_accel_get_gain(UINT16_MAX), POINTING_DEVICE_ACCEL_GAIN(2));
+}
+
+TEST_F(PointingAccel, FastMovementIsAccelerated) {
+    TestDriver driver;
+
+    pd_set_x(30);
+    pd_set_y(-25);
+    EXPECT_MOUSE_REPORT(driver, (60, -50, 0, 0, 0));
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingAccel, WheelIsNotAccelerated) {
+    TestDriver driver;
+
+    pd_set_x(30);
+    pd_set_h(5);
+    pd_set_v(-3);
+    EXPECT_MOUSE_REPORT(driver, (60, 0, 5, -3, 0));
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingAccel, SlowMovementCarriesRemainder) {
+    TestDriver driver;
+
+    pd_set_x(1);
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_MOUSE_REPORT(driver, (1, 0, 0, 0, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    pd_set_x(-1);
+    pd_set_y(-1);
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_MOUSE_REPORT(driver, (-1, -1, 0, 0, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingAccel, InterpolatedGainCarriesRemainder) {
+    TestDriver driver;
+
+    // 15 counts is halfway along the curve, 1.25 gain
+    pd_set_x(15);
+    EXPECT_MOUSE_REPORT(driver, (18, 0, 0, 0, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_MOUSE_REPORT(driver, (19, 0, 0, 0, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingAccel, DiagonalUsesCombinedSpeed) {
+    TestDriver driver;
+
+    // Each axis alone would get 0.5 gain, together they move fast enough for ~1.47
+    pd_set_x(12);
+    pd_set_y(12);
+    EXPECT_MOUSE_REPORT(driver, (17, 17, 0, 0, 0));
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingAccel, DirectionChangeDropsRemainder) {
+    TestDriver driver;
+
+    pd_set_x(1);
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    pd_set_x(-1);
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_MOUSE_REPORT(driver, (-1, 0, 0, 0, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingAccel, IdleDropsRemainder) {
+    TestDriver driver;
+
+    pd_set_x(1);
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+
+    pd_clear_movement();
+    idle_for(POINTING_DEVICE_ACCEL_IDLE_RESET_MS * 2);
+    VERIFY_AND_CLEAR(driver);
+
+    pd_set_x(1);
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_MOUSE_REPORT(driver, (1, 0, 0, 0, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingAccel, DisabledPassesThrough) {
+    TestDriver driver;
+
+    pointing_device_accel_set_enabled(false);
+    EXPECT_FALSE(pointing_device_accel_get_enabled());
+
+    pd_set_x(1);
+    pd_set_y(30);
+    EXPECT_MOUSE_REPORT(driver, (1, 30, 0, 0, 0));
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,70 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "mouse_report_util.hpp"
+#include "test_common.hpp"
+#include "test_pointing_device_driver.h"
+
+extern "C" {
+#include "pointing_device.h"
+}
+
+using testing::_;
+using testing::Invoke;
+
+class PointingOneEuro : public TestFixture {
+   protected:
+    void SetUp() override {
+        pointing_device_accel_reset();
+    }
+
+    void TearDown() override {
+        pd_clear_movement();
+        pointing_device_accel_reset();
+    }
+};
+
+TEST_F(PointingOneEuro, ConvergesAndSettles) {
+    TestDriver     driver;
+    report_mouse_t last = {};
+
+    EXPECT_ANY_MOUSE_REPORT(driver).WillRepeatedly(Invoke([&](report_mouse_t& report) { last = report; }));
+    pd_set_x(10);
+    pd_set_y(-5);
+    idle_for(50);
+    EXPECT_EQ(last.x, 10);
+    EXPECT_EQ(last.y, -5);
+
+    pd_clear_movement();
+    idle_for(POINTING_DEVICE_ACCEL_IDLE_RESET_MS);
+    VERIFY_AND_CLEAR(driver);
+
+    // The filter tail has fully drained
+    EXPECT_NO_MOUSE_REPORT(driver);
+    idle_for(POINTING_DEVICE_ACCEL_IDLE_RESET_MS);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingOneEuro, FastMovementHasLessLag) {
+    TestDriver driver;
+    int32_t    slow_total = 0;
+    int32_t    fast_total = 0;
+
+    EXPECT_ANY_MOUSE_REPORT(driver).WillRepeatedly(Invoke([&](report_mouse_t& report) { slow_total += report.x; }));
+    pd_set_x(4);
+    idle_for(5);
+    VERIFY_AND_CLEAR(driver);
+
+    pd_clear_movement();
+    pointing_device_accel_reset();
+
+    EXPECT_ANY_MOUSE_REPORT(driver).WillRepeatedly(Invoke([&](report_mouse_t& report) { fast_total += report.x; }));
+    pd_set_x(100);
+    idle_for(5);
+    VERIFY_AND_CLEAR(driver);
+
+    // Higher speed raises the cutoff, so a larger share of the step gets through straight away
+    EXPECT_GT(slow_total, 0);
+    EXPECT_GT(fast_total * 4, slow_total * 100);
+}
@@ -0,0 +1,12 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define POINTING_DEVICE_ACCEL_ENABLE
+#define POINTING_DEVICE_ACCEL_CURVE \
+    { {0, POINTING_DEVICE_ACCEL_GAIN(1)} }
+#define POINTING_DEVICE_SMOOTHING_EMA
+#define POINTING_DEVICE_SMOOTHING_EMA_ALPHA 128
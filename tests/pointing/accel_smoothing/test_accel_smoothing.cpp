@@ -0,0 +1,79 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "mouse_report_util.hpp"
+#include "test_common.hpp"
+#include "test_pointing_device_driver.h"
+
+extern "C" {
+#include "pointing_device.h"
+}
+
+using testing::_;
+
+class PointingSmoothing : public TestFixture {
+   protected:
+    void SetUp() override {
+        pointing_device_accel_reset();
+    }
+
+    void TearDown() override {
+        pd_clear_movement();
+        pointing_device_accel_reset();
+    }
+};
+
+TEST_F(PointingSmoothing, StepIsSmoothed) {
+    TestDriver driver;
+
+    pd_set_x(10);
+    pd_set_y(-10);
+    EXPECT_MOUSE_REPORT(driver, (5, -5, 0, 0, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_MOUSE_REPORT(driver, (7, -7, 0, 0, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_MOUSE_REPORT(driver, (9, -9, 0, 0, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingSmoothing, TailSettlesAfterStop) {
+    TestDriver driver;
+
+    pd_set_x(10);
+    EXPECT_MOUSE_REPORT(driver, (5, 0, 0, 0, 0));
+    EXPECT_MOUSE_REPORT(driver, (7, 0, 0, 0, 0));
+    EXPECT_MOUSE_REPORT(driver, (9, 0, 0, 0, 0));
+    run_one_scan_loop();
+    run_one_scan_loop();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    pd_clear_movement();
+    EXPECT_MOUSE_REPORT(driver, (4, 0, 0, 0, 0));
+    EXPECT_MOUSE_REPORT(driver, (2, 0, 0, 0, 0));
+    EXPECT_MOUSE_REPORT(driver, (1, 0, 0, 0, 0)).Times(2);
+    idle_for(20);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_MOUSE_REPORT(driver);
+    idle_for(20);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingSmoothing, DisabledPassesThrough) {
+    TestDriver driver;
+
+    pointing_device_accel_set_enabled(false);
+    pd_set_x(10);
+    EXPECT_MOUSE_REPORT(driver, (10, 0, 0, 0, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    pointing_device_accel_set_enabled(true);
+}
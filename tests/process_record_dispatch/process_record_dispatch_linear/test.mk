@@ -0,0 +1,11 @@
+# Copyright 2025 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# --------------------------------------------------------------------------------
+# Keep this file, even if it is empty, as a marker that this folder contains tests
+# --------------------------------------------------------------------------------
+
+include $(TEST_PATH)/../test.mk
+
+# Runs the same tests against the linear handler chain
+SRC += ../test_process_record_dispatch.cpp
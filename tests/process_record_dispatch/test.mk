@@ -0,0 +1,15 @@
+# Copyright 2025 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# --------------------------------------------------------------------------------
+# Keep this file, even if it is empty, as a marker that this folder contains tests
+# --------------------------------------------------------------------------------
+
+CAPS_WORD_ENABLE = yes
+COMMAND_ENABLE = no
+DYNAMIC_TAPPING_TERM_ENABLE = yes
+GRAVE_ESC_ENABLE = yes
+LAYER_LOCK_ENABLE = yes
+REPEAT_KEY_ENABLE = yes
+SPACE_CADET_ENABLE = yes
+TRI_LAYER_ENABLE = yes
@@ -0,0 +1,204 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// The same expectations are checked against both the range dispatched handler chain, and the
+// linear chain in the "linear" variant, so the two must produce identical output.
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "action_tapping.h"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+using testing::AnyOf;
+using testing::InSequence;
+
+static std::vector<uint16_t> user_keycodes;
+
+bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+    if (record->event.pressed) {
+        user_keycodes.push_back(keycode);
+    }
+    return true;
+}
+
+class ProcessRecordDispatch : public TestFixture {
+   protected:
+    void SetUp() override {
+        user_keycodes.clear();
+    }
+};
+
+TEST_F(ProcessRecordDispatch, EveryKeycodeReachesUser) {
+    TestDriver driver;
+    KeymapKey  key_a    = KeymapKey(0, 0, 0, KC_A);
+    KeymapKey  key_gesc = KeymapKey(0, 1, 0, QK_GRAVE_ESCAPE);
+    KeymapKey  key_user = KeymapKey(0, 2, 0, QK_USER);
+    KeymapKey  key_kb   = KeymapKey(0, 3, 0, QK_KB);
+
+    set_keymap({key_a, key_gesc, key_user, key_kb});
+
+    EXPECT_REPORT(driver, (KC_A)).Times(1);
+    EXPECT_REPORT(driver, (KC_ESCAPE)).Times(1);
+    EXPECT_EMPTY_REPORT(driver).Times(2);
+    tap_keys(key_a, key_gesc, key_user, key_kb);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(user_keycodes, (std::vector<uint16_t>{KC_A, QK_GRAVE_ESCAPE, QK_USER, QK_KB}));
+}
+
+TEST_F(ProcessRecordDispatch, GraveEscapeFollowsShift) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_shift = KeymapKey(0, 0, 0, KC_LSFT);
+    KeymapKey  key_gesc  = KeymapKey(0, 1, 0, QK_GRAVE_ESCAPE);
+
+    set_keymap({key_shift, key_gesc});
+
+    EXPECT_REPORT(driver, (KC_ESCAPE));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_gesc);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_REPORT(driver, (KC_LSFT, KC_GRAVE));
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_EMPTY_REPORT(driver);
+    key_shift.press();
+    run_one_scan_loop();
+    tap_key(key_gesc);
+    key_shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ProcessRecordDispatch, SpaceCadetSeesOtherKeys) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_lspo = KeymapKey(0, 0, 0, QK_SPACE_CADET_LEFT_SHIFT_PARENTHESIS_OPEN);
+    KeymapKey  key_a    = KeymapKey(0, 1, 0, KC_A);
+
+    set_keymap({key_lspo, key_a});
+
+    // Tapped alone, the key sends a parenthesis
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_REPORT(driver, (KC_LSFT, KC_9));
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_lspo);
+    VERIFY_AND_CLEAR(driver);
+
+    // Used as shift, it must have seen the other key to not send one
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_REPORT(driver, (KC_LSFT, KC_A));
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_EMPTY_REPORT(driver);
+    key_lspo.press();
+    run_one_scan_loop();
+    tap_key(key_a);
+    key_lspo.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ProcessRecordDispatch, CapsWordShiftsLetters) {
+    TestDriver driver;
+    KeymapKey  key_cw = KeymapKey(0, 0, 0, QK_CAPS_WORD_TOGGLE);
+    KeymapKey  key_a  = KeymapKey(0, 1, 0, KC_A);
+
+    set_keymap({key_cw, key_a});
+
+    // Allow any number of reports with no keys or only KC_LSFT.
+    EXPECT_CALL(driver, send_keyboard_mock(AnyOf(KeyboardReport(), KeyboardReport(KC_LSFT)))).Times(AnyNumber());
+    EXPECT_REPORT(driver, (KC_LSFT, KC_A));
+    tap_keys(key_cw, key_a);
+    EXPECT_TRUE(is_caps_word_on());
+    VERIFY_AND_CLEAR(driver);
+
+    caps_word_off();
+}
+
+TEST_F(ProcessRecordDispatch, RepeatKeyRepeatsLastKey) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_b   = KeymapKey(0, 0, 0, KC_B);
+    KeymapKey  key_rep = KeymapKey(0, 1, 0, QK_REPEAT_KEY);
+
+    set_keymap({key_b, key_rep});
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_keys(key_b, key_rep);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ProcessRecordDispatch, TriLayerReachesAdjust) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_lower = KeymapKey(0, 0, 0, QK_TRI_LAYER_LOWER);
+    KeymapKey  key_upper = KeymapKey(0, 1, 0, QK_TRI_LAYER_UPPER);
+    KeymapKey  key_c     = KeymapKey(0, 2, 0, KC_A);
+
+    set_keymap({key_lower, key_upper, key_c, KeymapKey(1, 0, 0, KC_TRNS), KeymapKey(1, 1, 0, KC_TRNS), KeymapKey(2, 0, 0, KC_TRNS), KeymapKey(2, 1, 0, KC_TRNS), KeymapKey(3, 2, 0, KC_C)});
+
+    EXPECT_REPORT(driver, (KC_C));
+    EXPECT_EMPTY_REPORT(driver);
+    key_lower.press();
+    key_upper.press();
+    run_one_scan_loop();
+    EXPECT_TRUE(layer_state_is(get_tri_layer_adjust_layer()));
+    tap_key(key_c);
+    key_lower.release();
+    key_upper.release();
+    run_one_scan_loop();
+    EXPECT_FALSE(layer_state_is(get_tri_layer_adjust_layer()));
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ProcessRecordDispatch, LayerLockKeepsMomentaryLayer) {
+    TestDriver driver;
+    KeymapKey  key_layer = KeymapKey(0, 0, 0, MO(1));
+    KeymapKey  key_trns  = KeymapKey(1, 0, 0, KC_TRNS);
+    KeymapKey  key_ll    = KeymapKey(1, 1, 0, QK_LAYER_LOCK);
+
+    set_keymap({key_layer, key_trns, key_ll});
+
+    EXPECT_NO_REPORT(driver);
+    key_layer.press();
+    run_one_scan_loop();
+    tap_key(key_ll);
+    key_layer.release();
+    run_one_scan_loop();
+    EXPECT_TRUE(layer_state_is(1));
+    EXPECT_TRUE(is_layer_locked(1));
+
+    // Pressing the momentary key again unlocks the layer
+    tap_key(key_layer);
+    EXPECT_FALSE(layer_state_is(1));
+    EXPECT_FALSE(is_layer_locked(1));
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ProcessRecordDispatch, DynamicTappingTermKeys) {
+    TestDriver driver;
+    KeymapKey  key_up   = KeymapKey(0, 0, 0, QK_DYNAMIC_TAPPING_TERM_UP);
+    KeymapKey  key_down = KeymapKey(0, 1, 0, QK_DYNAMIC_TAPPING_TERM_DOWN);
+
+    set_keymap({key_up, key_down});
+
+    uint16_t term = g_tapping_term;
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_up);
+    EXPECT_EQ(g_tapping_term, term + DYNAMIC_TAPPING_TERM_INCREMENT);
+    tap_keys(key_down, key_down);
+    EXPECT_EQ(g_tapping_term, term - DYNAMIC_TAPPING_TERM_INCREMENT);
+    tap_key(key_up);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(user_keycodes, (std::vector<uint16_t>{QK_DYNAMIC_TAPPING_TERM_UP, QK_DYNAMIC_TAPPING_TERM_DOWN, QK_DYNAMIC_TAPPING_TERM_DOWN, QK_DYNAMIC_TAPPING_TERM_UP}));
+}
@@ -0,0 +1,110 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "action_tapping.h"
+
+using testing::_;
+using testing::InSequence;
+
+#define LONG_TAPPING_TERM (TAPPING_TERM * 2)
+
+static uint8_t tapping_term_calls = 0;
+
+extern "C" uint16_t get_tapping_term(uint16_t keycode, keyrecord_t *record) {
+    tapping_term_calls++;
+    switch (keycode) {
+        case SFT_T(KC_P):
+            return LONG_TAPPING_TERM;
+        default:
+            return TAPPING_TERM;
+    }
+}
+
+class TappingTermPerKey : public TestFixture {
+   public:
+    void SetUp() override {
+        tapping_term_calls = 0;
+    }
+};
+
+TEST_F(TappingTermPerKey, long_tapping_term_key_taps_after_default_term) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_key = KeymapKey(0, 1, 0, SFT_T(KC_P));
+
+    set_keymap({mod_tap_key});
+
+    EXPECT_NO_REPORT(driver);
+    mod_tap_key.press();
+    idle_for(TAPPING_TERM + 10);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // The term is looked up when the key is pressed and released, not on every scan
+    EXPECT_LE(tapping_term_calls, 2);
+}
+
+TEST_F(TappingTermPerKey, default_tapping_term_key_holds_after_default_term) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_key = KeymapKey(0, 1, 0, SFT_T(KC_A));
+
+    set_keymap({mod_tap_key});
+
+    EXPECT_NO_REPORT(driver);
+    mod_tap_key.press();
+    idle_for(TAPPING_TERM - 1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    idle_for(2);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TappingTermPerKey, larger_waiting_buffer_holds_many_nested_taps) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_key = KeymapKey(0, 0, 0, SFT_T(KC_P));
+
+    std::vector<KeymapKey> keys = {mod_tap_key};
+    set_keymap({mod_tap_key});
+    for (uint8_t col = 1; col <= 10; col++) {
+        keys.push_back(KeymapKey(0, col % MATRIX_COLS, col / MATRIX_COLS + 1, KC_A + col));
+        add_key(keys.back());
+    }
+
+    /* Tap ten keys while the mod-tap key is undecided, which needs more than the default eight buffer entries. */
+    EXPECT_NO_REPORT(driver);
+    mod_tap_key.press();
+    run_one_scan_loop();
+    for (size_t i = 1; i < keys.size(); i++) {
+        keys[i].press();
+        run_one_scan_loop();
+        keys[i].release();
+        run_one_scan_loop();
+    }
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_P));
+    for (size_t i = 1; i < keys.size(); i++) {
+        EXPECT_REPORT(driver, (KC_P, keys[i].code));
+        EXPECT_REPORT(driver, (KC_P));
+    }
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
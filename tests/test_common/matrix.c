@@ -19,6 +19,7 @@
 #include <string.h>
 
 static matrix_row_t matrix[MATRIX_ROWS] = {};
+static uint32_t     row_reads           = 0;
 
 void matrix_init(void) {
     clear_all_keys();
@@ -31,9 +32,14 @@ uint8_t matrix_scan(void) {
 }
 
 matrix_row_t matrix_get_row(uint8_t row) {
+    row_reads++;
     return matrix[row];
 }
 
+uint32_t matrix_row_reads(void) {
+    return row_reads;
+}
+
 void matrix_print(void) {}
 
 void matrix_init_kb(void) {}
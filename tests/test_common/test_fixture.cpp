@@ -23,6 +23,7 @@ extern "C" {
 #include "debug.h"
 #include "eeconfig.h"
 #include "keyboard.h"
+#include "keymap_introspection.h"
 
 void set_time(uint32_t t);
 void advance_time(uint32_t ms);
@@ -36,6 +37,12 @@ TestFixture* TestFixture::m_this = nullptr;
 /* Override weak QMK function to allow the usage of isolated per-test keymaps in unit-tests.
  * The actual call is dynamicaly dispatched to the current active test fixture, which in turn has it's own keymap. */
 extern "C" uint16_t keymap_key_to_keycode(uint8_t layer, keypos_t position) {
+#ifdef ENCODER_MAP_ENABLE
+    /* Encoders are not part of the test keymap, so they resolve through the encoder map like on hardware. */
+    if (position.row == KEYLOC_ENCODER_CW || position.row == KEYLOC_ENCODER_CCW) {
+        return keycode_at_encodermap_location(layer, position.col, position.row == KEYLOC_ENCODER_CW);
+    }
+#endif // ENCODER_MAP_ENABLE
     uint16_t keycode;
     TestFixture::m_this->get_keycode(layer, position, &keycode);
     return keycode;
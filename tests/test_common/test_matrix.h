@@ -24,6 +24,9 @@ void press_key(uint8_t col, uint8_t row);
 void release_key(uint8_t col, uint8_t row);
 void clear_all_keys(void);
 
+// Number of matrix_get_row() calls so far, to count the passes over the matrix
+uint32_t matrix_row_reads(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,11 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Stand-in for the version.h generated by keyboard builds, so that tests are reproducible
+#pragma once
+
+#define QMK_VERSION "test"
+#define QMK_BUILDDATE "2025-01-01-00:00:00"
+#define QMK_GIT_HASH "test"
+#define CHIBIOS_VERSION "test"
+#define CHIBIOS_CONTRIB_VERSION "test"
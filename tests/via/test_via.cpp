@@ -0,0 +1,227 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "via.h"
+#include "raw_hid.h"
+#include "dynamic_keymap.h"
+#include "keymap_introspection.h"
+}
+
+using testing::_;
+
+static std::vector<uint8_t> last_response;
+static size_t               responses = 0;
+
+extern "C" void raw_hid_send(uint8_t *data, uint8_t length) {
+    last_response.assign(data, data + length);
+    ++responses;
+}
+
+// Replays VIA buffer transfers the way the configurator issues them: one 32 byte packet per 28 bytes of data
+class ViaReplay : public TestFixture {
+   protected:
+    static constexpr uint8_t packet_size  = 32;
+    static constexpr uint8_t payload_size = packet_size - 4;
+
+    void SetUp() override {
+        via_eeprom_set_valid(false);
+        via_init();
+        responses = 0;
+    }
+
+    std::vector<uint8_t> download(uint8_t command, uint16_t total) {
+        std::vector<uint8_t> result;
+        for (uint16_t offset = 0; offset < total; offset += payload_size) {
+            uint8_t size                = MIN(payload_size, total - offset);
+            uint8_t packet[packet_size] = {command, (uint8_t)(offset >> 8), (uint8_t)(offset & 0xFF), size};
+            raw_hid_receive(packet, sizeof(packet));
+            EXPECT_EQ(last_response[0], command) << "offset " << offset;
+            result.insert(result.end(), &last_response[4], &last_response[4 + size]);
+        }
+        return result;
+    }
+
+    void upload(uint8_t command, const std::vector<uint8_t> &data) {
+        for (uint16_t offset = 0; offset < data.size(); offset += payload_size) {
+            uint8_t size                = MIN(payload_size, data.size() - offset);
+            uint8_t packet[packet_size] = {command, (uint8_t)(offset >> 8), (uint8_t)(offset & 0xFF), size};
+            memcpy(&packet[4], &data[offset], size);
+            raw_hid_receive(packet, sizeof(packet));
+        }
+    }
+
+    static uint16_t keymap_size(void) {
+        return DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
+    }
+};
+
+TEST_F(ViaReplay, KeymapDownloadMatchesKeymap) {
+    auto     start   = std::chrono::steady_clock::now();
+    auto     keymap  = download(id_dynamic_keymap_get_buffer, keymap_size());
+    auto     elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    uint16_t packets = responses;
+
+    ASSERT_EQ(keymap.size(), keymap_size());
+    for (uint8_t layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t column = 0; column < MATRIX_COLS; column++) {
+                size_t offset = ((layer * MATRIX_ROWS + row) * MATRIX_COLS + column) * 2;
+                EXPECT_EQ((keymap[offset] << 8) | keymap[offset + 1], keycode_at_keymap_location_raw(layer, row, column)) << "layer " << +layer << " row " << +row << " column " << +column;
+            }
+        }
+    }
+
+    std::cout << "Keymap download: " << keymap.size() << " bytes in " << packets << " packets, " << elapsed.count() << "us" << std::endl;
+}
+
+TEST_F(ViaReplay, KeymapUploadRoundTrips) {
+    std::vector<uint8_t> keymap(keymap_size());
+    for (size_t i = 0; i < keymap.size(); i++) {
+        keymap[i] = (uint8_t)(i * 7 + 3);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    upload(id_dynamic_keymap_set_buffer, keymap);
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    std::cout << "Keymap upload: " << keymap.size() << " bytes in " << responses << " packets, " << elapsed.count() << "us" << std::endl;
+
+    EXPECT_EQ(download(id_dynamic_keymap_get_buffer, keymap_size()), keymap);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 1), (keymap[2] << 8) | keymap[3]);
+}
+
+TEST_F(ViaReplay, MacroBufferRoundTrips) {
+    uint16_t             size = dynamic_keymap_macro_get_buffer_size();
+    std::vector<uint8_t> macros(size, 0);
+    const char           text[] = "hello\0world\0";
+    memcpy(macros.data(), text, sizeof(text));
+    for (size_t i = sizeof(text); i + 1 < macros.size(); i++) {
+        macros[i] = 'a' + (i % 26);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    upload(id_dynamic_keymap_macro_set_buffer, macros);
+    auto readback = download(id_dynamic_keymap_macro_get_buffer, size);
+    auto elapsed  = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    std::cout << "Macro upload and download: " << size << " bytes in " << responses << " packets, " << elapsed.count() << "us" << std::endl;
+
+    EXPECT_EQ(readback, macros);
+}
+
+TEST_F(ViaReplay, TransfersPastTheEndAreZeroFilled) {
+    uint8_t packet[packet_size];
+    memset(packet, 0xAA, sizeof(packet));
+    uint16_t offset = keymap_size() - 4;
+    packet[0]       = id_dynamic_keymap_get_buffer;
+    packet[1]       = offset >> 8;
+    packet[2]       = offset & 0xFF;
+    packet[3]       = payload_size;
+    raw_hid_receive(packet, sizeof(packet));
+
+    uint16_t keycode = keycode_at_keymap_location_raw(DYNAMIC_KEYMAP_LAYER_COUNT - 1, MATRIX_ROWS - 1, MATRIX_COLS - 1);
+    EXPECT_EQ((last_response[6] << 8) | last_response[7], keycode);
+    for (uint8_t i = 8; i < packet_size; i++) {
+        EXPECT_EQ(last_response[i], 0) << "index " << +i;
+    }
+}
+
+TEST_F(ViaReplay, OversizedRequestsAreClamped) {
+    uint8_t packet[packet_size] = {id_dynamic_keymap_get_buffer, 0, 0, 0xFF};
+    raw_hid_receive(packet, sizeof(packet));
+    EXPECT_EQ(last_response.size(), (size_t)packet_size);
+    EXPECT_EQ((last_response[4] << 8) | last_response[5], keycode_at_keymap_location_raw(0, 0, 0));
+}
+
+class ViaMacroPlayback : public ViaReplay {
+   protected:
+    // Uploads the given macro strings the way the configurator does, marking the buffer as in progress until the last packet
+    void upload_macros(const std::vector<std::string> &strings) {
+        std::vector<uint8_t> macros(dynamic_keymap_macro_get_buffer_size(), 0);
+        size_t               offset = 0;
+        for (auto &s : strings) {
+            memcpy(&macros[offset], s.c_str(), s.size() + 1);
+            offset += s.size() + 1;
+        }
+        uint8_t last  = macros.back();
+        macros.back() = 0xFF;
+        upload(id_dynamic_keymap_macro_set_buffer, macros);
+        macros.back() = last;
+        upload(id_dynamic_keymap_macro_set_buffer, macros);
+    }
+};
+
+TEST_F(ViaMacroPlayback, SendsRequestedMacro) {
+    TestDriver driver;
+    upload_macros({"a", "bc", "d" SS_TAP(X_E) "f"});
+
+    testing::InSequence s;
+    EXPECT_REPORT(driver, (KC_D));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_E));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_F));
+    EXPECT_EMPTY_REPORT(driver);
+    dynamic_keymap_macro_send(2);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ViaMacroPlayback, LastSlotOfLargeBufferStartsImmediately) {
+    TestDriver               driver;
+    std::vector<std::string> strings(dynamic_keymap_macro_get_count() - 1, std::string(40, 'x'));
+    strings.push_back("z");
+    upload_macros(strings);
+
+    testing::InSequence s;
+    EXPECT_REPORT(driver, (KC_Z));
+    EXPECT_EMPTY_REPORT(driver);
+    auto start = std::chrono::steady_clock::now();
+    dynamic_keymap_macro_send(dynamic_keymap_macro_get_count() - 1);
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    std::cout << "Macro " << dynamic_keymap_macro_get_count() - 1 << " started and sent in " << elapsed.count() << "us" << std::endl;
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ViaMacroPlayback, LongMacroIsSentInFull) {
+    TestDriver  driver;
+    std::string text;
+    for (int i = 0; i < 100; i++) {
+        text += (char)('a' + (i % 26));
+    }
+    upload_macros({text});
+
+    testing::InSequence s;
+    for (char c : text) {
+        EXPECT_REPORT(driver, ((uint8_t)(KC_A + (c - 'a'))));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    dynamic_keymap_macro_send(0);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ViaMacroPlayback, MissingMacroSendsNothing) {
+    TestDriver driver;
+    upload_macros({"a", "b"});
+
+    EXPECT_NO_REPORT(driver);
+    dynamic_keymap_macro_send(5);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ViaMacroPlayback, InterruptedUploadSendsNothing) {
+    TestDriver driver;
+    upload_macros({"a", "b"});
+
+    uint16_t offset              = dynamic_keymap_macro_get_buffer_size() - 1;
+    uint8_t  packet[packet_size] = {id_dynamic_keymap_macro_set_buffer, (uint8_t)(offset >> 8), (uint8_t)(offset & 0xFF), 1, 0xFF};
+    raw_hid_receive(packet, sizeof(packet));
+
+    EXPECT_NO_REPORT(driver);
+    dynamic_keymap_macro_send(0);
+    VERIFY_AND_CLEAR(driver);
+}